@@ -9,6 +9,19 @@
 
 namespace OZZ::rendering {
 
+    // What a texture is used for next. TransitionTexture derives the layout, pipeline stages
+    // and access from it, and the barrier from the state the device tracked for the texture.
+    enum class TextureState {
+        Undefined, // contents may be discarded
+        ColorAttachment,
+        DepthStencilAttachment,
+        ShaderRead, // sampled or read by any graphics or compute shader stage
+        ComputeStorage, // storage image read and written by compute shaders
+        TransferSrc,
+        TransferDst,
+        Present,
+    };
+
     struct TextureBarrierDescriptor {
         RHITextureHandle Texture {};
         TextureLayout OldLayout {TextureLayout::Undefined};
@@ -3,14 +3,38 @@
 //
 
 #pragma once
+#include "ozz_rendering/rhi_handle.h"
 #include "ozz_rendering/utils/enums.h"
 #include <cstdint>
 
 namespace OZZ::rendering {
 
+    // Element type BindBuffer binds index buffers with; BindIndexBuffer takes an IndexType
     using IndexBufferElementType = uint32_t;
     constexpr auto IndexBufferElementSize = sizeof(IndexBufferElementType);
 
+    enum class IndexType : uint8_t {
+        UInt16,
+        UInt32,
+    };
+
+    // Argument layouts read by DrawIndirect / DrawIndexedIndirect; they match
+    // VkDrawIndirectCommand / VkDrawIndexedIndirectCommand and WebGPU's indirect buffers.
+    struct DrawIndirectCommand {
+        uint32_t VertexCount {0};
+        uint32_t InstanceCount {0};
+        uint32_t FirstVertex {0};
+        uint32_t FirstInstance {0};
+    };
+
+    struct DrawIndexedIndirectCommand {
+        uint32_t IndexCount {0};
+        uint32_t InstanceCount {0};
+        uint32_t FirstIndex {0};
+        int32_t VertexOffset {0};
+        uint32_t FirstInstance {0};
+    };
+
     enum class BufferMemoryAccess : uint8_t {
         GpuOnly,
         CpuToGpu,
@@ -27,10 +51,38 @@ namespace OZZ::rendering {
         Indirect = 1 << 6,
     };
 
+    // How often a buffer's contents change, which decides how many copies back it
+    enum class BufferLifetime : uint8_t {
+        // One copy. Host-visible updates write memory frames in flight may still read; GpuOnly
+        // updates are ordered after them. Meshes and other data written once.
+        Static,
+        // One copy per frame in flight; UpdateBuffer writes every copy
+        PerFrame,
+        // One copy per frame in flight; UpdateBuffer writes only the copy of the frame being
+        // recorded, so it may only be called between BeginFrame and SubmitAndPresentFrame and
+        // fails outside that window. For data rewritten every frame. Descriptor sets can only
+        // reference one through AllocateTransientDescriptorSet.
+        Stream,
+    };
+
     struct BufferDescriptor {
         uint64_t Size {0};
         BufferUsage Usage {BufferUsage::VertexBuffer};
         BufferMemoryAccess Access {BufferMemoryAccess::GpuOnly};
+        BufferLifetime Lifetime {BufferLifetime::PerFrame};
+        // Optional; Size bytes copied into every copy of the buffer on creation
+        const void* InitialData {nullptr};
+    };
+
+    // A slice of the frame's transient buffer (see RHIDevice::AllocateTransient). Offset is
+    // relative to Buffer and satisfies the offset alignment of the requested usage; Mapped
+    // stays writable until the frame is submitted.
+    struct TransientAllocation {
+        RHIBufferHandle Buffer {};
+        uint64_t Offset {0};
+        void* Mapped {nullptr};
+
+        [[nodiscard]] bool IsValid() const { return Mapped != nullptr; }
     };
 } // namespace OZZ::rendering
 
@@ -7,12 +7,22 @@
 #include "rhi_shader.h"
 
 #include <cstdint>
+#include <optional>
+#include <span>
 
 namespace OZZ::rendering {
     constexpr uint32_t MaxBoundDescriptorSets = 16;
     constexpr uint32_t MaxDescriptorSets = 16;
     constexpr uint32_t MaxPushConstantRanges = 4;
 
+    // Bindings of the global bindless set (RHIInitParams::EnableBindless), declared as runtime
+    // arrays in the set a shader names through BindlessSet. A texture's bindless index selects
+    // both its image and its sampler; buffers have indices of their own.
+    constexpr uint32_t BindlessTextureBinding = 0;
+    constexpr uint32_t BindlessSamplerBinding = 1;
+    constexpr uint32_t BindlessStorageBufferBinding = 2;
+    constexpr uint32_t InvalidBindlessIndex = UINT32_MAX;
+
     enum class DescriptorType {
         UniformBuffer,
         StorageBuffer,
@@ -25,6 +35,11 @@ namespace OZZ::rendering {
         // stage at all — it must be declared read-only storage. Vulkan has no such
         // restriction and treats this identically to StorageBuffer.
         ReadOnlyStorageBuffer,
+        // Uniform/storage buffers whose offset is added at bind time (BindDescriptorSet's
+        // dynamicOffsets), so one set can address many slices of a buffer, e.g. per-object
+        // constants from AllocateTransient. Write them with an explicit Range.
+        UniformBufferDynamic,
+        StorageBufferDynamic,
     };
 
     struct RHIDescriptorSetLayoutBinding {
@@ -52,6 +67,9 @@ namespace OZZ::rendering {
         uint32_t SetCount {0};
         RHIPushConstantRange PushConstants[MaxPushConstantRanges] {};
         uint32_t PushConstantCount {0};
+        // Set index taken by the device's global bindless set. Its bindings are ignored, no
+        // descriptor set layout handle is created for it, and binding the shader binds it.
+        std::optional<uint32_t> BindlessSet {};
     };
 
     struct RHIDescriptorWrite {
@@ -71,4 +89,27 @@ namespace OZZ::rendering {
         BufferInfo Buffer {};
         ImageInfo Image {};
     };
+
+    // Switches the listed buffer bindings of a reflected layout to their dynamic descriptor types
+    inline void ApplyDynamicBindings(RHIPipelineLayoutDescriptor& layout,
+                                     std::span<const ShaderDynamicBinding> dynamicBindings) {
+        for (const auto& dynamicBinding : dynamicBindings) {
+            if (dynamicBinding.Set >= layout.SetCount) {
+                continue;
+            }
+            auto& set = layout.Sets[dynamicBinding.Set];
+            for (uint32_t i = 0; i < set.BindingCount; i++) {
+                auto& binding = set.Bindings[i];
+                if (binding.Count == 0 || binding.Binding != dynamicBinding.Binding) {
+                    continue;
+                }
+                if (binding.Type == DescriptorType::UniformBuffer) {
+                    binding.Type = DescriptorType::UniformBufferDynamic;
+                } else if (binding.Type == DescriptorType::StorageBuffer ||
+                           binding.Type == DescriptorType::ReadOnlyStorageBuffer) {
+                    binding.Type = DescriptorType::StorageBufferDynamic;
+                }
+            }
+        }
+    }
 } // namespace OZZ::rendering
\ No newline at end of file
@@ -27,6 +27,10 @@
 
 namespace OZZ::rendering {
 
+    // Upper bound on RHIInitParams::FramesInFlight. Per-frame storage is sized at runtime,
+    // this only caps how far the CPU may run ahead of the GPU.
+    constexpr uint32_t MaxFramesInFlight = 4;
+
     // Native window handles for backends that construct their own surface (WebGPU).
     struct NativeWindowHandles {
         enum class Platform { None, Win32, Wayland, X11 } Platform {Platform::None};
@@ -57,6 +61,39 @@ namespace OZZ::rendering {
     struct RHIInitParams {
         RHIBackend Backend {RHIBackend::Auto};
         PlatformContext Context {};
+        // Number of frames the CPU may record ahead of the GPU. 1 minimizes latency, 3
+        // absorbs CPU spikes on GPU-bound scenes. Clamped to [1, MaxFramesInFlight]; the
+        // Vulkan backend additionally clamps to the swapchain image count.
+        uint32_t FramesInFlight {2};
+        // Route texture uploads through a transfer-only queue family when the device has one,
+        // so large uploads overlap with rendering. Vulkan only; ignored when unavailable.
+        bool UseDedicatedTransferQueue {true};
+        // Run async compute contexts (BeginAsyncCompute) on a compute-only queue family when the
+        // device has one, so they overlap with graphics. Vulkan only; without one, async compute
+        // is submitted to the graphics queue and the API behaves the same.
+        bool UseAsyncComputeQueue {true};
+        // Initial size of the persistently mapped ring that uploads are staged through.
+        // It doubles when full, up to MaxStagingRingSize; an upload that still does not fit gets
+        // a staging buffer of its own. Vulkan only.
+        uint64_t StagingRingSize {16ull * 1024 * 1024};
+        uint64_t MaxStagingRingSize {256ull * 1024 * 1024};
+        // Bytes each frame can hand out through AllocateTransient
+        uint64_t TransientBufferSize {4ull * 1024 * 1024};
+        // Registers every sampled texture and storage buffer in one global descriptor set so
+        // shaders can index them (see GetBindlessIndex and ShaderSourceParams::BindlessSet).
+        // Vulkan only, and only on devices with descriptor indexing; capacities are clamped to
+        // the device's update-after-bind limits.
+        bool EnableBindless {false};
+        uint32_t MaxBindlessTextures {16384};
+        uint32_t MaxBindlessBuffers {16384};
+        // Keep descriptor sets in a host-visible buffer (VK_EXT_descriptor_buffer) when the device
+        // supports it, so updates write descriptors directly and binds only set offsets. Vulkan
+        // only; sets of layouts with dynamic or bindless sets still come from descriptor pools.
+        bool UseDescriptorBuffer {true};
+        // Bytes per descriptor buffer, clamped to the device's limits. A full buffer gets a sibling
+        // of the same size, up to 8 or as many as the device binds at once; past that, creating
+        // such a set fails and returns a null handle.
+        uint64_t DescriptorBufferSize {8ull * 1024 * 1024};
     };
 
     class RHIFrameContext {
@@ -108,7 +145,8 @@ namespace OZZ::rendering {
     // descriptor sets and layouts) may be called from any thread, including
     // concurrently with frame recording. Frame-recording methods (BeginFrame
     // through SubmitAndPresentFrame, render passes, state/bind calls, draws)
-    // must be called from one thread at a time.
+    // must be called from one thread at a time per recording context; see
+    // ForkRecordingContexts for recording one frame from several threads.
     class RHIDevice {
     public:
         virtual ~RHIDevice() = default;
@@ -119,16 +157,86 @@ namespace OZZ::rendering {
         virtual void SubmitAndPresentFrame(RHIFrameContext&& frameContext) = 0;
         virtual std::pair<uint32_t, uint32_t> GetSwapchainExtent() const = 0;
 
+        // GPU progress. Every graphics queue submission signals a monotonically increasing value
+        // on a device-wide counter. GetSubmittedGpuValue is the last value handed to the
+        // GPU, GetCompletedGpuValue the last one the GPU finished. WaitForGpuValue blocks for
+        // at most timeoutNs and returns false on timeout; pass 0 to poll.
+        virtual uint64_t GetSubmittedGpuValue() const = 0;
+        virtual uint64_t GetCompletedGpuValue() const = 0;
+        virtual bool WaitForGpuValue(uint64_t value, uint64_t timeoutNs = UINT64_MAX) = 0;
+
+        // Parallel recording. ForkRecordingContexts hands out up to `count` recording contexts
+        // for the current frame, each of which may be recorded on its own thread through the
+        // regular Command Buffer Recording calls. JoinRecordingContexts closes them and splices
+        // their commands into the frame context in the order given. Contract:
+        //  - fork and join on the thread that owns the frame context, and join before the
+        //    next fork, EndRenderPass or SubmitAndPresentFrame;
+        //  - forked contexts inherit no state: set graphics state, viewport/scissor, shader
+        //    and descriptor sets again in each one;
+        //  - forked inside a render pass begun with RenderPassDescriptor::ParallelRecording,
+        //    the contexts draw into that pass, and the frame context itself may not draw
+        //    until EndRenderPass;
+        //  - backends without multithreaded recording return an empty vector, in which case
+        //    record on the frame context as usual.
+        virtual std::vector<RHIFrameContext> ForkRecordingContexts(const RHIFrameContext& frameContext,
+                                                                   uint32_t count) = 0;
+        virtual void JoinRecordingContexts(const RHIFrameContext& frameContext,
+                                           std::vector<RHIFrameContext>&& recordingContexts) = 0;
+
+        // Async compute. BeginAsyncCompute returns a recording context for the current frame
+        // whose commands run on the compute queue. It takes the binding, barrier, push constant
+        // and Dispatch calls, but no render passes or graphics state. SubmitAsyncCompute submits
+        // it immediately and returns its sync point. FlushGraphics submits the graphics commands
+        // recorded on the frame context so far (outside a render pass), so compute can consume
+        // them within the same frame; recording then continues on the frame context.
+        // AddQueueDependency makes the next submission of `context` (a frame or async compute
+        // context) wait on the GPU for `syncPoint` before `waitStage`. Contract:
+        //  - begin and submit async compute contexts on the thread that owns the frame context,
+        //    within that frame; each may be recorded on one other thread in between;
+        //  - a resource written on one queue and read on the other needs a release barrier on
+        //    the first queue and a matching acquire barrier on the second, with SrcQueueFamily /
+        //    DstQueueFamily from GetQueueFamily, unless its previous contents can be discarded;
+        //  - only depend on sync points that were already submitted;
+        //  - backends without async compute return a null context from BeginAsyncCompute and a
+        //    null sync point from FlushGraphics; record Dispatch on the frame context instead.
+        virtual RHIFrameContext BeginAsyncCompute(const RHIFrameContext& frameContext) = 0;
+        virtual GpuSyncPoint SubmitAsyncCompute(RHIFrameContext&& computeContext) = 0;
+        virtual GpuSyncPoint FlushGraphics(const RHIFrameContext& frameContext) = 0;
+        virtual void AddQueueDependency(const RHIFrameContext& context,
+                                        const GpuSyncPoint& syncPoint,
+                                        PipelineStage waitStage) = 0;
+        virtual uint32_t GetQueueFamily(QueueType queue) const = 0;
+
+        // Graphics state objects. Immutable; free them once no recording uses them anymore.
+        virtual RHIGraphicsStateHandle CreateGraphicsState(const GraphicsStateDescriptor& graphicsStateDescriptor) = 0;
+        virtual void FreeGraphicsState(const RHIGraphicsStateHandle& graphicsStateHandle) = 0;
+
         // Command Buffer Recording - Render Pass
         virtual void BeginRenderPass(const RHIFrameContext& frameContext,
                                      const RenderPassDescriptor& renderPassDescriptor) = 0;
         virtual void EndRenderPass(const RHIFrameContext& frameContext) = 0;
 
-        // Command Buffer Recording - Barriers
+        // Command Buffer Recording - Barriers. Barriers are batched: they accumulate on the
+        // recording context and are recorded together, as one pipeline barrier, right before the
+        // next render pass, draw, dispatch or submission that follows them. Record them outside
+        // render passes. A BufferBarrierDescriptor with Size 0 covers the rest of the buffer.
         virtual void TextureResourceBarrier(const RHIFrameContext& frameContext,
                                             const TextureBarrierDescriptor& textureBarrierDescriptor) = 0;
         virtual void BufferMemoryBarrier(const RHIFrameContext& frameContext,
                                          const BufferBarrierDescriptor& bufferBarrierDescriptor) = 0;
+        virtual void PipelineBarriers(const RHIFrameContext& frameContext,
+                                      std::span<const TextureBarrierDescriptor> textureBarriers,
+                                      std::span<const BufferBarrierDescriptor> bufferBarriers) = 0;
+        // The device tracks each texture's layout and last access per mip level and array layer,
+        // in recording order, through TransitionTexture, manual barriers and uploads. This adds
+        // the barrier from the tracked state to newState, or nothing when both are the same
+        // read-only state. The aspect comes from the texture's format. Keep transitions of a
+        // texture on one recording context per frame, since forked contexts record out of order.
+        // OZZ_DEBUG builds check the OldLayout of manual barriers against the tracked layout.
+        virtual void TransitionTexture(const RHIFrameContext& frameContext,
+                                       const RHITextureHandle& textureHandle,
+                                       TextureState newState,
+                                       const TextureSubresourceRange& subresourceRange = {}) = 0;
 
         // Command Buffer Recording - State
         virtual void SetViewport(const RHIFrameContext& frameContext, const Viewport& viewport) = 0;
@@ -137,10 +245,30 @@ namespace OZZ::rendering {
         // before any draw. State never carries over from a previous render pass.
         virtual void SetGraphicsState(const RHIFrameContext& frameContext,
                                       const GraphicsStateDescriptor& graphicsStateDescriptor) = 0;
+        // Same as above with a state object from CreateGraphicsState, whose backend values were
+        // converted up front. Setting the state object the command buffer already holds is a
+        // handle compare.
+        virtual void SetGraphicsState(const RHIFrameContext& frameContext,
+                                      const RHIGraphicsStateHandle& graphicsStateHandle) = 0;
+        // Commands SetGraphicsState has skipped since the device was created because the command
+        // buffer already held those values. WebGPU bakes state into pipelines and counts skipped
+        // pipeline binds instead.
+        virtual uint64_t GetElidedStateCommandCount() const = 0;
 
         // Command Buffer Recording - Binding
         virtual void BindShader(const RHIFrameContext& frameContext, const RHIShaderHandle& shaderHandle) = 0;
+        // Binds a vertex buffer at binding 0, or an index buffer of IndexBufferElementType, at offset 0
         virtual void BindBuffer(const RHIFrameContext& frameContext, const RHIBufferHandle& bufferHandle) = 0;
+        // Binds buffers to consecutive vertex input bindings starting at firstBinding. offsets is
+        // either empty (all zero) or holds one byte offset per buffer.
+        virtual void BindVertexBuffers(const RHIFrameContext& frameContext,
+                                       uint32_t firstBinding,
+                                       std::span<const RHIBufferHandle> bufferHandles,
+                                       std::span<const uint64_t> offsets = {}) = 0;
+        virtual void BindIndexBuffer(const RHIFrameContext& frameContext,
+                                     const RHIBufferHandle& bufferHandle,
+                                     uint64_t offset = 0,
+                                     IndexType indexType = IndexType::UInt32) = 0;
         virtual void SetPushConstants(const RHIFrameContext& frameContext,
                                       RHIPipelineLayoutHandle pipelineLayoutHandle,
                                       ShaderStageFlags stageFlags,
@@ -150,7 +278,8 @@ namespace OZZ::rendering {
         virtual void BindDescriptorSet(const RHIFrameContext& frameContext,
                                        RHIPipelineLayoutHandle pipelineLayoutHandle,
                                        uint32_t setIndex,
-                                       RHIDescriptorSetHandle descriptorSetHandle) = 0;
+                                       RHIDescriptorSetHandle descriptorSetHandle,
+                                       std::span<const uint32_t> dynamicOffsets = {}) = 0;
 
         // Command Buffer Recording - Draw
         virtual void Draw(const RHIFrameContext& frameContext,
@@ -164,19 +293,87 @@ namespace OZZ::rendering {
                                  uint32_t firstIndex,
                                  int32_t vertexOffset,
                                  uint32_t firstInstance) = 0;
+        // Indirect draws read drawCount DrawIndirectCommand / DrawIndexedIndirectCommand entries,
+        // stride bytes apart, starting at `offset` in a buffer created with BufferUsage::Indirect.
+        // The Count variants read the number of draws as a uint32_t at countOffset in countBuffer
+        // and draw at most maxDrawCount. Where the GPU cannot read the count (WebGPU, or Vulkan
+        // without drawIndirectCount) all maxDrawCount entries are drawn, so write an
+        // InstanceCount of 0 into the entries past the count.
+        virtual void DrawIndirect(const RHIFrameContext& frameContext,
+                                  const RHIBufferHandle& argumentBuffer,
+                                  uint64_t offset,
+                                  uint32_t drawCount,
+                                  uint32_t stride = sizeof(DrawIndirectCommand)) = 0;
+        virtual void DrawIndexedIndirect(const RHIFrameContext& frameContext,
+                                         const RHIBufferHandle& argumentBuffer,
+                                         uint64_t offset,
+                                         uint32_t drawCount,
+                                         uint32_t stride = sizeof(DrawIndexedIndirectCommand)) = 0;
+        virtual void DrawIndirectCount(const RHIFrameContext& frameContext,
+                                       const RHIBufferHandle& argumentBuffer,
+                                       uint64_t offset,
+                                       const RHIBufferHandle& countBuffer,
+                                       uint64_t countOffset,
+                                       uint32_t maxDrawCount,
+                                       uint32_t stride = sizeof(DrawIndirectCommand)) = 0;
+        virtual void DrawIndexedIndirectCount(const RHIFrameContext& frameContext,
+                                              const RHIBufferHandle& argumentBuffer,
+                                              uint64_t offset,
+                                              const RHIBufferHandle& countBuffer,
+                                              uint64_t countOffset,
+                                              uint32_t maxDrawCount,
+                                              uint32_t stride = sizeof(DrawIndexedIndirectCommand)) = 0;
+
+        // Command Buffer Recording - Compute. Dispatches run the bound compute shader and must
+        // be recorded outside of a render pass. DispatchIndirect reads a
+        // {groupCountX, groupCountY, groupCountZ} uint32_t triple at `offset` in a buffer
+        // created with BufferUsage::Indirect. Synchronize compute writes against later reads
+        // with TextureResourceBarrier / BufferMemoryBarrier (PipelineStage::ComputeShader).
+        virtual void Dispatch(const RHIFrameContext& frameContext,
+                              uint32_t groupCountX,
+                              uint32_t groupCountY,
+                              uint32_t groupCountZ) = 0;
+        virtual void DispatchIndirect(const RHIFrameContext& frameContext,
+                                      const RHIBufferHandle& bufferHandle,
+                                      uint64_t offset) = 0;
 
         // Descriptor Sets
         virtual RHIDescriptorSetHandle CreateDescriptorSet(RHIDescriptorSetLayoutHandle layoutHandle) = 0;
         virtual void UpdateDescriptorSet(RHIDescriptorSetHandle handle, std::span<const RHIDescriptorWrite> writes) = 0;
         virtual void FreeDescriptorSet(RHIDescriptorSetHandle handle) = 0;
+        // A set that lives until the frame slot comes around again, for per-frame inputs such as
+        // post-process sources or per-draw overrides. Update and bind it like any other set;
+        // there is nothing to free, as BeginFrame recycles all of a slot's sets at once. The only
+        // kind of set that may reference BufferLifetime::Stream buffers.
+        virtual RHIDescriptorSetHandle AllocateTransientDescriptorSet(const RHIFrameContext& frameContext,
+                                                                      RHIDescriptorSetLayoutHandle layoutHandle) = 0;
 
         // Resource Creation
         virtual RHITextureHandle CreateTexture(TextureDescriptor&& descriptor) = 0;
         virtual void UpdateTexture(const RHITextureHandle& handle, const void* data, size_t size) = 0;
         virtual void FreeTexture(RHITextureHandle handle) = 0;
+        // Stable index of a sampled texture or storage buffer in the bindless arrays, valid until the
+        // resource is freed. InvalidBindlessIndex when bindless is off or the resource has none.
+        // Stream buffers are not registered; buffers are indexed as copy 0.
+        virtual uint32_t GetBindlessIndex(const RHITextureHandle& handle) = 0;
+        virtual uint32_t GetBindlessIndex(const RHIBufferHandle& handle) = 0;
+
+        // Batched uploads. UpdateTextureAsync stages the data and records the copy into the open
+        // upload batch without waiting on the GPU, and returns that batch's ticket. SubmitUploads
+        // submits the open batch and returns its ticket (the last submitted batch's if nothing is
+        // pending); SubmitAndPresentFrame does the same ahead of the frame's own commands. A
+        // texture may be used once IsUploadComplete returns true for its ticket, or by graphics
+        // work submitted after its batch. WaitForUpload submits the batch if needed and blocks for
+        // at most timeoutNs. UpdateTexture is UpdateTextureAsync followed by WaitForUpload.
+        virtual UploadTicket UpdateTextureAsync(const RHITextureHandle& handle, const void* data, size_t size) = 0;
+        virtual UploadTicket SubmitUploads() = 0;
+        virtual bool IsUploadComplete(const UploadTicket& ticket) = 0;
+        virtual bool WaitForUpload(const UploadTicket& ticket, uint64_t timeoutNs = UINT64_MAX) = 0;
 
         virtual RHIShaderHandle CreateShader(ShaderFileParams&& fileParams) = 0;
         virtual RHIShaderHandle CreateShader(ShaderSourceParams&& sourceParams) = 0;
+        virtual RHIShaderHandle CreateComputeShader(ComputeShaderFileParams&& fileParams) = 0;
+        virtual RHIShaderHandle CreateComputeShader(ComputeShaderSourceParams&& sourceParams) = 0;
         virtual void FreeShader(const RHIShaderHandle& shaderHandle) = 0;
         virtual RHIPipelineLayoutDescriptor GetShaderPipelineLayout(const RHIShaderHandle& shaderHandle) = 0;
         virtual RHIPipelineLayoutHandle GetShaderPipelineLayoutHandle(const RHIShaderHandle& shaderHandle) = 0;
@@ -184,10 +381,24 @@ namespace OZZ::rendering {
         GetShaderDescriptorSetLayoutHandles(const RHIShaderHandle& shaderHandle) = 0;
         virtual std::pair<RHIPipelineLayoutHandle, std::set<RHIDescriptorSetLayoutHandle>>
         CreatePipelineLayout(const RHIPipelineLayoutDescriptor& pipelineLayoutDescriptor) = 0;
+        // A layout for sets bound with pipelineLayoutHandle. Vulkan keeps a pipeline layout's sets
+        // either all in the descriptor buffer or all in pools; without a pipeline layout the
+        // sets come from pools, which only match layouts that have a dynamic or bindless set.
         virtual RHIDescriptorSetLayoutHandle
-        CreateDescriptorSetLayout(const RHIDescriptorSetLayoutDescriptor& descriptorSetLayoutDescriptor) = 0;
+        CreateDescriptorSetLayout(const RHIDescriptorSetLayoutDescriptor& descriptorSetLayoutDescriptor,
+                                  const RHIPipelineLayoutHandle& pipelineLayoutHandle = {}) = 0;
 
         virtual RHIBufferHandle CreateBuffer(BufferDescriptor&& bufferDescriptor) = 0;
+        // Carves size bytes for usage out of the frame's transient buffer, reclaimed once the frame
+        // slot comes around again; there is nothing to free. All allocations share one buffer
+        // handle, so per-object data can go through one set with dynamic offsets. Returns an
+        // invalid allocation when this frame's share of TransientBufferSize is used up.
+        virtual TransientAllocation
+        AllocateTransient(const RHIFrameContext& frameContext, uint64_t size, BufferUsage usage) = 0;
+        // Host-visible buffers are written immediately. GpuOnly buffers are written by a staged
+        // copy in the open upload batch, which graphics work submitted after it observes (see
+        // SubmitUploads); the data is copied out before this returns. Stream buffers may only be
+        // updated between BeginFrame and SubmitAndPresentFrame.
         virtual void UpdateBuffer(const RHIBufferHandle&, const void* data, size_t size, size_t offset) = 0;
         virtual void FreeBuffer(const RHIBufferHandle& handle) = 0;
 
@@ -0,0 +1,130 @@
+//
+// Created by paulm on 2026-10-16.
+//
+
+#pragma once
+#include <ozz_rendering/rhi_device.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace OZZ::rendering {
+    inline constexpr uint32_t MaxDrawPacketDescriptorSets = 4;
+    inline constexpr uint32_t MaxDrawPacketVertexBuffers = 4;
+
+    // One draw and the bindings it needs. Null handles and zero counts mean "not used by this
+    // packet": the previous binding, or whatever was bound before Flush, stays in place.
+    struct DrawPacket {
+        // Packets are replayed in ascending key order; equal keys keep submission order within
+        // a thread. Put the most expensive state changes in the high bits, e.g.
+        // [pass:8][shader:16][state:12][material:12][depth:16].
+        uint64_t SortKey {0};
+
+        RHIShaderHandle Shader {};
+        RHIGraphicsStateHandle State {};
+
+        // Descriptor sets bound to sets FirstDescriptorSet.. of PipelineLayout; the dynamic
+        // offsets passed to Push are consumed in set order, DynamicOffsetCounts[i] for each.
+        RHIPipelineLayoutHandle PipelineLayout {};
+        uint32_t FirstDescriptorSet {0};
+        uint32_t DescriptorSetCount {0};
+        std::array<RHIDescriptorSetHandle, MaxDrawPacketDescriptorSets> DescriptorSets {};
+        std::array<uint8_t, MaxDrawPacketDescriptorSets> DynamicOffsetCounts {};
+
+        uint32_t VertexBufferCount {0};
+        std::array<RHIBufferHandle, MaxDrawPacketVertexBuffers> VertexBuffers {};
+        std::array<uint64_t, MaxDrawPacketVertexBuffers> VertexBufferOffsets {};
+
+        RHIBufferHandle IndexBuffer {};
+        uint64_t IndexBufferOffset {0};
+        IndexType IndexBufferType {IndexType::UInt32};
+
+        // Push constant bytes passed to Push land at offset 0 of the layout's range
+        ShaderStageFlags PushConstantStages {ShaderStageFlags::All};
+
+        // Draw when IndexBuffer is null (VertexOrIndexCount/FirstVertexOrIndex are vertices),
+        // DrawIndexed otherwise
+        uint32_t VertexOrIndexCount {0};
+        uint32_t InstanceCount {1};
+        uint32_t FirstVertexOrIndex {0};
+        int32_t VertexOffset {0};
+        uint32_t FirstInstance {0};
+    };
+
+    // Calls Flush recorded or skipped because the previous packet had already bound the same thing
+    struct DrawQueueFlushStats {
+        uint32_t Packets {0};
+        uint32_t ShaderBinds {0};
+        uint32_t StateBinds {0};
+        uint32_t DescriptorSetBinds {0};
+        uint32_t VertexBufferBinds {0};
+        uint32_t IndexBufferBinds {0};
+        uint32_t PushConstantWrites {0};
+        uint32_t SkippedBinds {0};
+    };
+
+    // Collects draw packets from any number of threads and replays them sorted by key, binding
+    // only what changes between consecutive packets. Each thread pushes into its own bucket, so
+    // Push takes no lock after a thread's first push into a queue. Flush merges the buckets,
+    // radix-sorts on SortKey and records everything on one recording context; it must not
+    // overlap with Push. Buckets keep their capacity across flushes.
+    //
+    // Flush records into whatever render pass is open on the context and assumes nothing about
+    // the bindings already there, so the first packet binds everything it names. Viewport and
+    // scissor are left to the caller.
+    class RHIDrawQueue {
+    public:
+        RHIDrawQueue();
+        ~RHIDrawQueue();
+        RHIDrawQueue(const RHIDrawQueue&) = delete;
+        RHIDrawQueue& operator=(const RHIDrawQueue&) = delete;
+
+        void Push(const DrawPacket& packet,
+                  std::span<const std::byte> pushConstants = {},
+                  std::span<const uint32_t> dynamicOffsets = {});
+
+        DrawQueueFlushStats Flush(RHIDevice& device, const RHIFrameContext& frameContext);
+        // Drops every queued packet without recording
+        void Clear();
+
+        [[nodiscard]] size_t Size() const;
+
+    private:
+        struct QueuedPacket {
+            DrawPacket Packet {};
+            uint32_t PushConstantStart {0};
+            uint32_t PushConstantSize {0};
+            uint32_t DynamicOffsetStart {0};
+        };
+
+        // Packets from one thread; push constants and dynamic offsets live in side arenas
+        struct Bucket {
+            std::vector<QueuedPacket> Packets;
+            std::vector<std::byte> PushConstants;
+            std::vector<uint32_t> DynamicOffsets;
+        };
+
+        struct SortEntry {
+            uint64_t Key {0};
+            uint32_t BucketIndex {0};
+            uint32_t PacketIndex {0};
+        };
+
+        Bucket& localBucket();
+
+        const uint64_t queueId;
+        mutable std::mutex bucketsMutex;
+        std::unordered_map<std::thread::id, uint32_t> bucketIndices;
+        std::vector<std::unique_ptr<Bucket>> buckets;
+
+        std::vector<SortEntry> sortEntries;
+        std::vector<SortEntry> sortScratch;
+    };
+} // namespace OZZ::rendering
@@ -33,6 +33,7 @@ namespace OZZ::rendering {
     using RHICommandBufferHandle = RHIHandle<struct CommandBufferTag>;
     using RHIShaderHandle = RHIHandle<struct ShaderTag>;
     using RHIBufferHandle = RHIHandle<struct BufferTag>;
+    using RHIGraphicsStateHandle = RHIHandle<struct GraphicsStateTag>;
 
     // Descriptors
     using RHIPipelineLayoutHandle = RHIHandle<struct PipelineLayoutTag>;
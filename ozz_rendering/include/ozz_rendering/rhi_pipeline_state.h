@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <ozz_rendering/rhi_types.h>
 
@@ -58,12 +60,16 @@ namespace OZZ::rendering {
         ColorComponentFlags ColorWriteMask {
             static_cast<ColorComponentFlags>(ColorComponent::All),
         };
+
+        bool operator==(const ColorBlendAttachmentState&) const = default;
     };
 
     struct VertexInputBindingDescriptor {
         uint32_t Binding {0};
         uint32_t Stride {0};
         VertexInputRate InputRate {VertexInputRate::Vertex};
+
+        bool operator==(const VertexInputBindingDescriptor&) const = default;
     };
 
     struct VertexInputAttributeDescriptor {
@@ -71,6 +77,8 @@ namespace OZZ::rendering {
         uint32_t Binding {0};
         VertexFormat Format {VertexFormat::Float3};
         uint32_t Offset {0};
+
+        bool operator==(const VertexInputAttributeDescriptor&) const = default;
     };
 
     struct VertexInputState {
@@ -78,6 +86,13 @@ namespace OZZ::rendering {
         uint32_t BindingCount {0};
         VertexInputAttributeDescriptor Attributes[MaxVertexAttributes] {};
         uint32_t AttributeCount {0};
+
+        // Entries past BindingCount / AttributeCount are ignored
+        bool operator==(const VertexInputState& other) const {
+            return BindingCount == other.BindingCount && AttributeCount == other.AttributeCount &&
+                   std::equal(Bindings, Bindings + BindingCount, other.Bindings) &&
+                   std::equal(Attributes, Attributes + AttributeCount, other.Attributes);
+        }
     };
 
     struct GraphicsStateDescriptor {
@@ -90,4 +105,74 @@ namespace OZZ::rendering {
         VertexInputState VertexInput {};
     };
 
+    // 64-bit FNV-1a over every field that affects rendering. Entries past the blend attachment
+    // and vertex input counts are skipped, as are padding bytes, so equal states hash equal.
+    inline uint64_t HashGraphicsState(const GraphicsStateDescriptor& state) {
+        uint64_t hash = 0xcbf29ce484222325ULL;
+        const auto mix = [&hash](const auto value) {
+            const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+            for (size_t i = 0; i < sizeof(value); ++i) {
+                hash ^= bytes[i];
+                hash *= 0x100000001b3ULL;
+            }
+        };
+
+        mix(state.InputAssembly.Topology);
+        mix(state.InputAssembly.PrimitiveRestartEnable);
+
+        const auto& rasterization = state.Rasterization;
+        mix(rasterization.Cull);
+        mix(rasterization.Front);
+        mix(rasterization.Polygon);
+        mix(rasterization.DepthBiasEnable);
+        mix(rasterization.RasterizerDiscard);
+        mix(rasterization.LineWidth);
+        mix(rasterization.PointSize);
+
+        const auto& depthStencil = state.DepthStencil;
+        mix(depthStencil.DepthTestEnable);
+        mix(depthStencil.DepthWriteEnable);
+        mix(depthStencil.StencilTestEnable);
+        mix(depthStencil.DepthCompareOp);
+        mix(depthStencil.StencilCompareOp);
+        mix(depthStencil.StencilPassOp);
+        mix(depthStencil.StencilFailOp);
+        mix(depthStencil.StencilDepthFailOp);
+        mix(depthStencil.StencilWriteMask);
+        mix(depthStencil.StencilFaceMask);
+
+        mix(state.Multisample.Samples);
+        mix(state.Multisample.SampleMask);
+        mix(state.Multisample.AlphaToCoverageEnable);
+
+        mix(state.ColorBlendAttachmentCount);
+        for (uint32_t i = 0; i < state.ColorBlendAttachmentCount; ++i) {
+            const auto& blend = state.ColorBlend[i];
+            mix(blend.BlendEnable);
+            mix(blend.SrcColorFactor);
+            mix(blend.DstColorFactor);
+            mix(blend.ColorBlendOp);
+            mix(blend.SrcAlphaFactor);
+            mix(blend.DstAlphaFactor);
+            mix(blend.AlphaBlendOp);
+            mix(blend.ColorWriteMask);
+        }
+
+        const auto& vertexInput = state.VertexInput;
+        mix(vertexInput.BindingCount);
+        for (uint32_t i = 0; i < vertexInput.BindingCount; ++i) {
+            mix(vertexInput.Bindings[i].Binding);
+            mix(vertexInput.Bindings[i].Stride);
+            mix(vertexInput.Bindings[i].InputRate);
+        }
+        mix(vertexInput.AttributeCount);
+        for (uint32_t i = 0; i < vertexInput.AttributeCount; ++i) {
+            mix(vertexInput.Attributes[i].Location);
+            mix(vertexInput.Attributes[i].Binding);
+            mix(vertexInput.Attributes[i].Format);
+            mix(vertexInput.Attributes[i].Offset);
+        }
+        return hash;
+    }
+
 } // namespace OZZ::rendering
@@ -0,0 +1,174 @@
+//
+// Created by paulm on 2026-10-16.
+//
+
+#pragma once
+#include <ozz_rendering/rhi_device.h>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace OZZ::rendering {
+    class RHIRenderGraph;
+
+    // A texture declared on a render graph. Only meaningful to the graph that returned it, and
+    // only until that graph's next Reset.
+    struct RenderGraphTexture {
+        uint32_t Index {UINT32_MAX};
+
+        [[nodiscard]] bool IsValid() const { return Index != UINT32_MAX; }
+    };
+
+    // Resolves graph textures to the device textures backing them this frame. Handed to pass
+    // execute callbacks; transient textures may be backed by a different texture every frame.
+    class RenderGraphResources {
+    public:
+        [[nodiscard]] RHITextureHandle GetTexture(RenderGraphTexture texture) const;
+
+    private:
+        friend class RHIRenderGraph;
+        explicit RenderGraphResources(const RHIRenderGraph& graph) : graph(graph) {}
+
+        const RHIRenderGraph& graph;
+    };
+
+    // Declares what a pass does with the graph's textures. Every declaration becomes a
+    // TransitionTexture before the pass runs. Attachments also make the graph wrap the pass in
+    // BeginRenderPass/EndRenderPass, with the render area covering the first attachment.
+    class RenderGraphPassBuilder {
+    public:
+        RenderGraphPassBuilder& Read(RenderGraphTexture texture, TextureState state = TextureState::ShaderRead);
+        RenderGraphPassBuilder& Write(RenderGraphTexture texture, TextureState state = TextureState::ComputeStorage);
+        // LoadOp::Load also counts as a read of the previous contents. A valid resolveTarget
+        // receives the resolve of a multisampled texture and counts as written by the pass.
+        RenderGraphPassBuilder& ColorAttachment(RenderGraphTexture texture,
+                                                LoadOp load = LoadOp::Clear,
+                                                const ClearValue& clear = {},
+                                                StoreOp store = StoreOp::Store,
+                                                RenderGraphTexture resolveTarget = {});
+        RenderGraphPassBuilder& DepthAttachment(RenderGraphTexture texture,
+                                                LoadOp load = LoadOp::Clear,
+                                                const ClearValue& clear = {},
+                                                StoreOp store = StoreOp::Store);
+        // Never culled, e.g. for passes that write buffers or read back results
+        RenderGraphPassBuilder& SideEffect();
+
+    private:
+        friend class RHIRenderGraph;
+        RenderGraphPassBuilder(RHIRenderGraph& graph, uint32_t passIndex) : graph(graph), passIndex(passIndex) {}
+
+        RHIRenderGraph& graph;
+        uint32_t passIndex;
+    };
+
+    using RenderGraphSetupFunction = std::function<void(RenderGraphPassBuilder&)>;
+    using RenderGraphExecuteFunction =
+        std::function<void(RHIDevice&, const RHIFrameContext&, const RenderGraphResources&)>;
+
+    // Records a frame's passes in declaration order with the barriers between them derived from
+    // what each pass declared. Rebuild it every frame: Reset, import and create textures, add
+    // passes, then Execute on the frame context outside any render pass.
+    //
+    // Compiling culls passes whose writes nothing reads, unless they write an imported or
+    // output texture or are marked as a side effect, and assigns transient textures to pooled
+    // device textures. Transients with the same descriptor whose lifetimes do not overlap share
+    // one texture; its contents are discarded at the start of each lifetime. A transient that
+    // is only an attachment of a single pass gets TextureUsage::Transient and is never stored.
+    // The pool outlives frames, and the compiled plan is reused as long as the declarations
+    // keep the same shape, so a steady frame allocates nothing and skips compilation.
+    class RHIRenderGraph {
+    public:
+        explicit RHIRenderGraph(RHIDevice& device);
+        ~RHIRenderGraph();
+        RHIRenderGraph(const RHIRenderGraph&) = delete;
+        RHIRenderGraph& operator=(const RHIRenderGraph&) = delete;
+
+        // Drops the declared passes and textures; pooled textures and the cached plan are kept
+        void Reset();
+
+        // An externally owned texture, e.g. the backbuffer. Its contents are always preserved
+        // and the graph leaves it in the state of its last use.
+        RenderGraphTexture ImportTexture(const RHITextureHandle& handle, uint32_t width, uint32_t height);
+        // A texture that only lives within the frame. The descriptor's Usage is ignored: usage
+        // comes from what the passes declare.
+        RenderGraphTexture CreateTexture(const TextureDescriptor& descriptor);
+        // Keeps the writers of a transient texture and its contents alive until the end of the
+        // frame, so it can be read through GetTexture after Execute
+        void MarkOutput(RenderGraphTexture texture);
+
+        void AddPass(std::string name, const RenderGraphSetupFunction& setup, RenderGraphExecuteFunction execute);
+
+        void Execute(const RHIFrameContext& frameContext);
+
+        // The device texture backing a graph texture. Transients are backed only once Execute
+        // has compiled the graph, and not at all when every pass using them was culled.
+        [[nodiscard]] RHITextureHandle GetTexture(RenderGraphTexture texture) const;
+        [[nodiscard]] bool IsPassCulled(uint32_t passIndex) const;
+
+    private:
+        friend class RenderGraphPassBuilder;
+
+        struct TextureAccess {
+            uint32_t Texture {0};
+            TextureState State {TextureState::Undefined};
+            bool bReads {false};
+            bool bWrites {false};
+        };
+
+        struct AttachmentUse {
+            uint32_t Texture {UINT32_MAX};
+            uint32_t ResolveTexture {UINT32_MAX};
+            LoadOp Load {LoadOp::Clear};
+            StoreOp Store {StoreOp::Store};
+            ClearValue Clear {};
+        };
+
+        struct Pass {
+            std::string Name;
+            RenderGraphExecuteFunction Execute;
+            std::vector<TextureAccess> Accesses;
+            AttachmentUse ColorAttachments[MaxColorAttachments] {};
+            uint32_t ColorAttachmentCount {0};
+            AttachmentUse DepthAttachment {};
+            bool bSideEffect {false};
+        };
+
+        struct GraphTexture {
+            TextureDescriptor Descriptor {};
+            RHITextureHandle Imported {};
+            bool bOutput {false};
+
+            [[nodiscard]] bool IsImported() const { return Imported.IsValid(); }
+        };
+
+        // Result of compiling one graph shape; indices match passes and textures
+        struct CompiledPlan {
+            uint64_t Hash {0};
+            std::vector<bool> Culled;
+            // Pool index per texture, UINT32_MAX for imported or unused ones
+            std::vector<uint32_t> PooledTextures;
+            // Pass index at which each texture's lifetime starts, UINT32_MAX if it never does
+            std::vector<uint32_t> FirstUses;
+        };
+
+        struct PooledTexture {
+            TextureDescriptor Descriptor {};
+            RHITextureHandle Handle {};
+        };
+
+        void addAccess(uint32_t passIndex, RenderGraphTexture texture, TextureState state, bool bReads, bool bWrites);
+        [[nodiscard]] StoreOp storeOpFor(const AttachmentUse& attachment) const;
+        [[nodiscard]] uint64_t hashTopology() const;
+        void compile();
+
+        RHIDevice& device;
+
+        std::vector<Pass> passes;
+        std::vector<GraphTexture> textures;
+
+        CompiledPlan plan {};
+        std::vector<PooledTexture> pool;
+    };
+} // namespace OZZ::rendering
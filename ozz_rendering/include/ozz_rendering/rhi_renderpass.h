@@ -25,6 +25,10 @@ namespace OZZ::rendering {
         StoreOp Store {StoreOp::Store};
         ClearValue Clear {};
         TextureLayout Layout {TextureLayout::ColorAttachment};
+        // Single-sample texture the multisampled Texture is resolved into at the end of the
+        // pass, in the same layout. Store can then be DontCare, ideally on a Transient texture.
+        RHITextureHandle ResolveTexture {};
+        ResolveMode Resolve {ResolveMode::Average};
     };
 
     struct RenderPassDescriptor {
@@ -34,6 +38,9 @@ namespace OZZ::rendering {
         AttachmentDescriptor StencilAttachment {};
         RenderAreaDescriptor RenderArea {};
         uint32_t LayerCount {1};
+        // Draws for this pass are recorded on contexts from RHIDevice::ForkRecordingContexts
+        // rather than on the frame context itself.
+        bool ParallelRecording {false};
     };
 
 } // namespace OZZ::rendering
\ No newline at end of file
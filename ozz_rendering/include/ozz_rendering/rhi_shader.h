@@ -5,6 +5,7 @@
 #pragma once
 
 #include <filesystem>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -17,6 +18,7 @@ namespace OZZ::rendering {
         Vertex = 1 << 0,
         Geometry = 1 << 1,
         Fragment = 1 << 2,
+        Compute = 1 << 3,
         All = 0xFFFFFFFF,
     };
 
@@ -27,6 +29,14 @@ namespace OZZ::rendering {
         std::string Value;
     };
 
+    // A uniform or storage buffer binding whose offset is supplied when its set is bound
+    // (BindDescriptorSet's dynamicOffsets) rather than when the set is written. Reflection
+    // cannot tell these apart, so shaders list them explicitly.
+    struct ShaderDynamicBinding {
+        uint32_t Set {0};
+        uint32_t Binding {0};
+    };
+
     struct ShaderSourceParams {
         std::string Vertex;
         std::string Geometry;
@@ -36,6 +46,10 @@ namespace OZZ::rendering {
         std::string Slang;
         // Slang preprocessor macros; ignored by GLSL paths.
         std::vector<ShaderDefine> Defines;
+        // Buffer bindings the reflected layout declares as dynamic.
+        std::vector<ShaderDynamicBinding> DynamicBindings;
+        // Set the shader declares the bindless arrays in (see BindlessTextureBinding); Vulkan only.
+        std::optional<uint32_t> BindlessSet;
     };
 
     struct ShaderFileParams {
@@ -46,6 +60,38 @@ namespace OZZ::rendering {
         std::filesystem::path Slang;
         // Slang preprocessor macros; ignored by GLSL paths.
         std::vector<ShaderDefine> Defines;
+        // Buffer bindings the reflected layout declares as dynamic.
+        std::vector<ShaderDynamicBinding> DynamicBindings;
+        // Set the shader declares the bindless arrays in (see BindlessTextureBinding); Vulkan only.
+        std::optional<uint32_t> BindlessSet;
+    };
+
+    // Compute programs are created through RHIDevice::CreateComputeShader and bound with
+    // BindShader like graphics ones; they are dispatched outside of render passes.
+    struct ComputeShaderSourceParams {
+        // GLSL compute stage source (Vulkan only).
+        std::string Compute;
+        // Complete Slang module source with a `computeMain` entry point; when non-empty,
+        // the Slang compilation path is used instead of the GLSL Compute path.
+        std::string Slang;
+        // Slang preprocessor macros; ignored by GLSL paths.
+        std::vector<ShaderDefine> Defines;
+        // Buffer bindings the reflected layout declares as dynamic.
+        std::vector<ShaderDynamicBinding> DynamicBindings;
+        // Set the shader declares the bindless arrays in (see BindlessTextureBinding); Vulkan only.
+        std::optional<uint32_t> BindlessSet;
+    };
+
+    struct ComputeShaderFileParams {
+        std::filesystem::path Compute;
+        // Whole-module Slang file; takes precedence over Compute when non-empty.
+        std::filesystem::path Slang;
+        // Slang preprocessor macros; ignored by GLSL paths.
+        std::vector<ShaderDefine> Defines;
+        // Buffer bindings the reflected layout declares as dynamic.
+        std::vector<ShaderDynamicBinding> DynamicBindings;
+        // Set the shader declares the bindless arrays in (see BindlessTextureBinding); Vulkan only.
+        std::optional<uint32_t> BindlessSet;
     };
 
 } // namespace OZZ::rendering
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <cstdint>
+#include <ozz_rendering/rhi_types.h>
 #include <ozz_rendering/utils/enums.h>
 
 namespace OZZ::rendering {
@@ -26,6 +27,10 @@ namespace OZZ::rendering {
         DepthAttachment = 1 << 2, // VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT
         TransferSrc = 1 << 3,     // VK_IMAGE_USAGE_TRANSFER_SRC_BIT
         TransferDst = 1 << 4,     // VK_IMAGE_USAGE_TRANSFER_DST_BIT
+        Storage = 1 << 5,         // VK_IMAGE_USAGE_STORAGE_BIT
+        // VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT, lazily allocated memory where available. Only
+        // combines with ColorAttachment / DepthAttachment; for attachments that never leave a pass.
+        Transient = 1 << 6,
     };
 
     enum class TextureFilter { Linear, Nearest };
@@ -45,6 +50,9 @@ namespace OZZ::rendering {
         uint32_t Height {1};
         TextureFormat Format {TextureFormat::RGBA8};
         TextureUsage Usage {TextureUsage::Sampled};
+        // Above Count1 the texture can only be an attachment, resolved into a single-sample
+        // texture through AttachmentDescriptor::ResolveTexture
+        SampleCount Samples {SampleCount::Count1};
         SamplerDescriptor Sampler {};
     };
 
@@ -20,6 +20,15 @@ namespace OZZ::rendering {
         DontCare,
     };
 
+    // How a multisampled attachment is resolved at the end of a render pass. Depth and stencil
+    // resolve Average as SampleZero; Min and Max need device support for them.
+    enum class ResolveMode {
+        Average,
+        SampleZero,
+        Min,
+        Max,
+    };
+
     enum class TextureLayout {
         Undefined,
         ColorAttachment,
@@ -28,6 +37,7 @@ namespace OZZ::rendering {
         TransferSrc,
         TransferDst,
         Present,
+        General, // storage images read/written by compute
     };
 
     enum class PrimitiveTopology {
@@ -71,6 +81,8 @@ namespace OZZ::rendering {
         VertexShader,
         FragmentShader,
         EarlyFragmentTests,
+        ComputeShader,
+        DrawIndirect, // indirect argument reads (DispatchIndirect)
         AllGraphics,
         AllCommands,
     };
@@ -85,6 +97,7 @@ namespace OZZ::rendering {
         TransferWrite,
         DepthStencilAttachmentRead,
         DepthStencilAttachmentWrite,
+        IndirectCommandRead,
     };
 
     enum class TextureAspect {
@@ -103,6 +116,28 @@ namespace OZZ::rendering {
 
     inline constexpr uint32_t QueueFamilyIgnored = ~0u;
 
+    enum class QueueType {
+        Graphics,
+        Compute, // async compute; shares the graphics queue when the device has no separate one
+    };
+
+    // A point on one queue's timeline, reached once every submission to that queue up to
+    // Value has finished. Value 0 is the null point: there is nothing to wait for.
+    struct GpuSyncPoint {
+        QueueType Queue {QueueType::Graphics};
+        uint64_t Value {0};
+
+        [[nodiscard]] bool IsValid() const { return Value != 0; }
+    };
+
+    // Identifies a batch of texture uploads (see RHIDevice::UpdateTextureAsync). The value is
+    // backend-defined; 0 is the null ticket, which is always complete.
+    struct UploadTicket {
+        uint64_t Value {0};
+
+        [[nodiscard]] bool IsValid() const { return Value != 0; }
+    };
+
     enum class ColorComponent : uint8_t {
         R = 1 << 0,
         G = 1 << 1,
@@ -8,6 +8,7 @@
 #include <functional>
 #include <mutex>
 #include <optional>
+#include <span>
 #include <vector>
 
 #include <ozz_rendering/rhi_device.h>
@@ -67,13 +68,14 @@ namespace OZZ::rendering {
 
         void Free(const RHIHandle<Tag>& handle) {
             std::lock_guard lock(mutex);
-            if (isValidHandleNoLock(handle)) {
-                if (auto& slot = Slots[handle.Id]; slot.Occupied()) {
-                    destroyFunction(Slots[handle.Id].Resource.value());
-                    Slots[handle.Id].Resource.reset();
-                    FreeIndices.push_back(handle.Id);
-                    ++slot.Generation;
-                }
+            freeNoLock(handle);
+        }
+
+        // Frees a batch under one lock; invalid and already freed handles are skipped
+        void Free(std::span<const RHIHandle<Tag>> handles) {
+            std::lock_guard lock(mutex);
+            for (const auto& handle : handles) {
+                freeNoLock(handle);
             }
         }
 
@@ -102,6 +104,17 @@ namespace OZZ::rendering {
         }
 
     private:
+        void freeNoLock(const RHIHandle<Tag>& handle) {
+            if (isValidHandleNoLock(handle)) {
+                if (auto& slot = Slots[handle.Id]; slot.Occupied()) {
+                    destroyFunction(slot.Resource.value());
+                    slot.Resource.reset();
+                    FreeIndices.push_back(handle.Id);
+                    ++slot.Generation;
+                }
+            }
+        }
+
         bool isValidHandleNoLock(const RHIHandle<Tag>& handle) const {
             return handle.Id < Slots.size() && Slots[handle.Id].Generation == handle.Generation &&
                    Slots[handle.Id].Occupied();
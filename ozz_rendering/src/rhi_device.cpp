@@ -25,10 +25,10 @@ OZZ::rendering::RHIBackend OZZ::rendering::ResolveBackend(RHIBackend preferred)
 std::unique_ptr<OZZ::rendering::RHIDevice> OZZ::rendering::CreateRHIDevice(const RHIInitParams& params) {
     switch (ResolveBackend(params.Backend)) {
         case RHIBackend::Vulkan:
-            return std::make_unique<vk::RHIDeviceVulkan>(params.Context);
+            return std::make_unique<vk::RHIDeviceVulkan>(params);
         case RHIBackend::WebGPU:
 #if defined(OZZ_WEBGPU_ENABLED)
-            return std::make_unique<webgpu::RHIDeviceWebGPU>(params.Context);
+            return std::make_unique<webgpu::RHIDeviceWebGPU>(params);
 #else
             throw std::runtime_error("WebGPU backend not compiled in (set OZZ_ENABLE_WEBGPU=ON)");
 #endif
@@ -0,0 +1,292 @@
+//
+// Created by paulm on 2026-10-16.
+//
+
+#include <ozz_rendering/profiling.h>
+#include <ozz_rendering/rhi_draw_queue.h>
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <utility>
+
+#include <spdlog/spdlog.h>
+
+namespace OZZ::rendering {
+    namespace {
+        // Never reused, so a thread's cached bucket can not outlive its queue and be mistaken
+        // for a bucket of a later queue at the same address
+        std::atomic<uint64_t> nextQueueId {1};
+    } // namespace
+
+    RHIDrawQueue::RHIDrawQueue() : queueId(nextQueueId.fetch_add(1, std::memory_order_relaxed)) {}
+
+    RHIDrawQueue::~RHIDrawQueue() = default;
+
+    RHIDrawQueue::Bucket& RHIDrawQueue::localBucket() {
+        thread_local std::pair<uint64_t, Bucket*> cached {0, nullptr};
+        if (cached.first == queueId) {
+            return *cached.second;
+        }
+
+        std::lock_guard lock(bucketsMutex);
+        const auto [it, bInserted] =
+            bucketIndices.try_emplace(std::this_thread::get_id(), static_cast<uint32_t>(buckets.size()));
+        if (bInserted) {
+            buckets.push_back(std::make_unique<Bucket>());
+        }
+        cached = {queueId, buckets[it->second].get()};
+        return *cached.second;
+    }
+
+    void RHIDrawQueue::Push(const DrawPacket& packet,
+                            std::span<const std::byte> pushConstants,
+                            std::span<const uint32_t> dynamicOffsets) {
+        if (packet.DescriptorSetCount > MaxDrawPacketDescriptorSets ||
+            packet.FirstDescriptorSet + packet.DescriptorSetCount > MaxBoundDescriptorSets) {
+            spdlog::error("DrawQueue: packet binds sets {}..{}, at most {} sets below {} are supported",
+                          packet.FirstDescriptorSet,
+                          packet.FirstDescriptorSet + packet.DescriptorSetCount,
+                          MaxDrawPacketDescriptorSets,
+                          MaxBoundDescriptorSets);
+            return;
+        }
+        if (packet.VertexBufferCount > MaxDrawPacketVertexBuffers) {
+            spdlog::error("DrawQueue: packet binds {} vertex buffers, at most {} are supported",
+                          packet.VertexBufferCount,
+                          MaxDrawPacketVertexBuffers);
+            return;
+        }
+        const auto dynamicOffsetCount = std::accumulate(packet.DynamicOffsetCounts.begin(),
+                                                        packet.DynamicOffsetCounts.begin() + packet.DescriptorSetCount,
+                                                        size_t {0});
+        if (dynamicOffsetCount != dynamicOffsets.size()) {
+            spdlog::error("DrawQueue: packet declares {} dynamic offsets but {} were given",
+                          dynamicOffsetCount,
+                          dynamicOffsets.size());
+            return;
+        }
+        if ((packet.DescriptorSetCount > 0 || !pushConstants.empty()) && !packet.PipelineLayout.IsValid()) {
+            spdlog::error("DrawQueue: packet with descriptor sets or push constants needs a pipeline layout");
+            return;
+        }
+
+        auto& bucket = localBucket();
+        bucket.Packets.push_back({
+            .Packet = packet,
+            .PushConstantStart = static_cast<uint32_t>(bucket.PushConstants.size()),
+            .PushConstantSize = static_cast<uint32_t>(pushConstants.size()),
+            .DynamicOffsetStart = static_cast<uint32_t>(bucket.DynamicOffsets.size()),
+        });
+        bucket.PushConstants.insert(bucket.PushConstants.end(), pushConstants.begin(), pushConstants.end());
+        bucket.DynamicOffsets.insert(bucket.DynamicOffsets.end(), dynamicOffsets.begin(), dynamicOffsets.end());
+    }
+
+    void RHIDrawQueue::Clear() {
+        std::lock_guard lock(bucketsMutex);
+        for (const auto& bucket : buckets) {
+            bucket->Packets.clear();
+            bucket->PushConstants.clear();
+            bucket->DynamicOffsets.clear();
+        }
+    }
+
+    size_t RHIDrawQueue::Size() const {
+        std::lock_guard lock(bucketsMutex);
+        size_t size = 0;
+        for (const auto& bucket : buckets) {
+            size += bucket->Packets.size();
+        }
+        return size;
+    }
+
+    DrawQueueFlushStats RHIDrawQueue::Flush(RHIDevice& device, const RHIFrameContext& frameContext) {
+        OZZ_PROFILE_FUNCTION;
+        DrawQueueFlushStats stats {};
+
+        sortEntries.clear();
+        for (uint32_t b = 0; b < buckets.size(); ++b) {
+            const auto& packets = buckets[b]->Packets;
+            for (uint32_t p = 0; p < packets.size(); ++p) {
+                sortEntries.push_back({.Key = packets[p].Packet.SortKey, .BucketIndex = b, .PacketIndex = p});
+            }
+        }
+        if (sortEntries.empty()) {
+            return stats;
+        }
+
+        // LSD radix sort, one byte per pass. All eight histograms are built in a single sweep and
+        // passes where every key has the same byte are skipped, so keys that only use their high
+        // bits cost a pass or two. Stable, so equal keys replay in submission order per bucket.
+        const size_t count = sortEntries.size();
+        std::array<std::array<uint32_t, 256>, 8> histograms {};
+        for (const auto& entry : sortEntries) {
+            for (uint32_t pass = 0; pass < 8; ++pass) {
+                ++histograms[pass][(entry.Key >> (pass * 8)) & 0xFF];
+            }
+        }
+        sortScratch.resize(count);
+        for (uint32_t pass = 0; pass < 8; ++pass) {
+            auto& histogram = histograms[pass];
+            const uint32_t shift = pass * 8;
+            if (histogram[(sortEntries.front().Key >> shift) & 0xFF] == count) {
+                continue;
+            }
+            uint32_t offset = 0;
+            for (auto& bin : histogram) {
+                offset += std::exchange(bin, offset);
+            }
+            for (const auto& entry : sortEntries) {
+                sortScratch[histogram[(entry.Key >> shift) & 0xFF]++] = entry;
+            }
+            sortEntries.swap(sortScratch);
+        }
+
+        // What the previous packet left bound. Spans point into the bucket arenas, which stay put
+        // until the buckets are cleared below.
+        RHIShaderHandle boundShader {};
+        RHIGraphicsStateHandle boundState {};
+        RHIPipelineLayoutHandle boundLayout {};
+        std::array<RHIDescriptorSetHandle, MaxBoundDescriptorSets> boundSets {};
+        std::array<std::span<const uint32_t>, MaxBoundDescriptorSets> boundDynamicOffsets {};
+        std::array<RHIBufferHandle, MaxDrawPacketVertexBuffers> boundVertexBuffers {};
+        std::array<uint64_t, MaxDrawPacketVertexBuffers> boundVertexOffsets {};
+        RHIBufferHandle boundIndexBuffer {};
+        uint64_t boundIndexOffset {0};
+        IndexType boundIndexType {IndexType::UInt32};
+        ShaderStageFlags boundPushStages {};
+        std::span<const std::byte> boundPushConstants {};
+
+        for (const auto& entry : sortEntries) {
+            const auto& bucket = *buckets[entry.BucketIndex];
+            const auto& queued = bucket.Packets[entry.PacketIndex];
+            const auto& packet = queued.Packet;
+            ++stats.Packets;
+
+            if (packet.Shader.IsValid()) {
+                if (packet.Shader == boundShader) {
+                    ++stats.SkippedBinds;
+                } else {
+                    device.BindShader(frameContext, packet.Shader);
+                    boundShader = packet.Shader;
+                    ++stats.ShaderBinds;
+                }
+            }
+
+            if (packet.State.IsValid()) {
+                if (packet.State == boundState) {
+                    ++stats.SkippedBinds;
+                } else {
+                    device.SetGraphicsState(frameContext, packet.State);
+                    boundState = packet.State;
+                    ++stats.StateBinds;
+                }
+            }
+
+            // Sets and push constants bound through another layout may be disturbed; bind afresh
+            if (packet.PipelineLayout.IsValid() && !(packet.PipelineLayout == boundLayout)) {
+                boundLayout = packet.PipelineLayout;
+                boundSets.fill(RHIDescriptorSetHandle::Null());
+                boundPushConstants = {};
+            }
+
+            uint32_t dynamicOffsetCursor = queued.DynamicOffsetStart;
+            for (uint32_t i = 0; i < packet.DescriptorSetCount; ++i) {
+                const uint32_t setIndex = packet.FirstDescriptorSet + i;
+                const std::span<const uint32_t> offsets {bucket.DynamicOffsets.data() + dynamicOffsetCursor,
+                                                         packet.DynamicOffsetCounts[i]};
+                dynamicOffsetCursor += packet.DynamicOffsetCounts[i];
+                if (!packet.DescriptorSets[i].IsValid()) {
+                    continue;
+                }
+                if (packet.DescriptorSets[i] == boundSets[setIndex] &&
+                    std::ranges::equal(offsets, boundDynamicOffsets[setIndex])) {
+                    ++stats.SkippedBinds;
+                    continue;
+                }
+                device.BindDescriptorSet(frameContext, boundLayout, setIndex, packet.DescriptorSets[i], offsets);
+                boundSets[setIndex] = packet.DescriptorSets[i];
+                boundDynamicOffsets[setIndex] = offsets;
+                ++stats.DescriptorSetBinds;
+            }
+
+            // One call for the range of bindings that changed
+            uint32_t firstChanged = packet.VertexBufferCount;
+            uint32_t lastChanged = 0;
+            for (uint32_t i = 0; i < packet.VertexBufferCount; ++i) {
+                if (!(packet.VertexBuffers[i] == boundVertexBuffers[i]) ||
+                    packet.VertexBufferOffsets[i] != boundVertexOffsets[i]) {
+                    firstChanged = std::min(firstChanged, i);
+                    lastChanged = i;
+                }
+            }
+            if (firstChanged < packet.VertexBufferCount) {
+                const uint32_t changedCount = lastChanged - firstChanged + 1;
+                device.BindVertexBuffers(frameContext,
+                                         firstChanged,
+                                         std::span(packet.VertexBuffers).subspan(firstChanged, changedCount),
+                                         std::span(packet.VertexBufferOffsets).subspan(firstChanged, changedCount));
+                std::copy_n(packet.VertexBuffers.begin() + firstChanged,
+                            changedCount,
+                            boundVertexBuffers.begin() + firstChanged);
+                std::copy_n(packet.VertexBufferOffsets.begin() + firstChanged,
+                            changedCount,
+                            boundVertexOffsets.begin() + firstChanged);
+                ++stats.VertexBufferBinds;
+            } else if (packet.VertexBufferCount > 0) {
+                ++stats.SkippedBinds;
+            }
+
+            const bool bIndexed = packet.IndexBuffer.IsValid();
+            if (bIndexed) {
+                if (packet.IndexBuffer == boundIndexBuffer && packet.IndexBufferOffset == boundIndexOffset &&
+                    packet.IndexBufferType == boundIndexType) {
+                    ++stats.SkippedBinds;
+                } else {
+                    device.BindIndexBuffer(
+                        frameContext, packet.IndexBuffer, packet.IndexBufferOffset, packet.IndexBufferType);
+                    boundIndexBuffer = packet.IndexBuffer;
+                    boundIndexOffset = packet.IndexBufferOffset;
+                    boundIndexType = packet.IndexBufferType;
+                    ++stats.IndexBufferBinds;
+                }
+            }
+
+            if (queued.PushConstantSize > 0) {
+                const std::span<const std::byte> bytes {bucket.PushConstants.data() + queued.PushConstantStart,
+                                                        queued.PushConstantSize};
+                if (packet.PushConstantStages == boundPushStages && std::ranges::equal(bytes, boundPushConstants)) {
+                    ++stats.SkippedBinds;
+                } else {
+                    device.SetPushConstants(
+                        frameContext, boundLayout, packet.PushConstantStages, 0, queued.PushConstantSize, bytes.data());
+                    boundPushStages = packet.PushConstantStages;
+                    boundPushConstants = bytes;
+                    ++stats.PushConstantWrites;
+                }
+            }
+
+            if (bIndexed) {
+                device.DrawIndexed(frameContext,
+                                   packet.VertexOrIndexCount,
+                                   packet.InstanceCount,
+                                   packet.FirstVertexOrIndex,
+                                   packet.VertexOffset,
+                                   packet.FirstInstance);
+            } else {
+                device.Draw(frameContext,
+                            packet.VertexOrIndexCount,
+                            packet.InstanceCount,
+                            packet.FirstVertexOrIndex,
+                            packet.FirstInstance);
+            }
+        }
+
+        for (const auto& bucket : buckets) {
+            bucket->Packets.clear();
+            bucket->PushConstants.clear();
+            bucket->DynamicOffsets.clear();
+        }
+        return stats;
+    }
+} // namespace OZZ::rendering
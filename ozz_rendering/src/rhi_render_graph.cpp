@@ -0,0 +1,451 @@
+//
+// Created by paulm on 2026-10-16.
+//
+
+#include <ozz_rendering/profiling.h>
+#include <ozz_rendering/rhi_render_graph.h>
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+#include <spdlog/spdlog.h>
+
+namespace OZZ::rendering {
+    namespace {
+        // FNV-1a, folded one value at a time
+        class TopologyHasher {
+        public:
+            template <typename T>
+            void Add(T value) {
+                const auto bits = static_cast<uint64_t>(value);
+                for (uint32_t shift = 0; shift < 64; shift += 8) {
+                    hash = (hash ^ ((bits >> shift) & 0xFF)) * 0x100000001B3ull;
+                }
+            }
+
+            [[nodiscard]] uint64_t Get() const { return hash; }
+
+        private:
+            uint64_t hash {0xCBF29CE484222325ull};
+        };
+
+        TextureUsage UsageForState(const TextureState state) {
+            switch (state) {
+                case TextureState::ColorAttachment:
+                    return TextureUsage::ColorAttachment;
+                case TextureState::DepthStencilAttachment:
+                    return TextureUsage::DepthAttachment;
+                case TextureState::ShaderRead:
+                    return TextureUsage::Sampled;
+                case TextureState::ComputeStorage:
+                    return TextureUsage::Storage;
+                case TextureState::TransferSrc:
+                    return TextureUsage::TransferSrc;
+                case TextureState::TransferDst:
+                    return TextureUsage::TransferDst;
+                default:
+                    return {};
+            }
+        }
+
+        bool SameDescriptor(const TextureDescriptor& a, const TextureDescriptor& b) {
+            return a.Width == b.Width && a.Height == b.Height && a.Format == b.Format && a.Usage == b.Usage &&
+                   a.Samples == b.Samples && a.Sampler.MinFilter == b.Sampler.MinFilter &&
+                   a.Sampler.MagFilter == b.Sampler.MagFilter && a.Sampler.WrapU == b.Sampler.WrapU &&
+                   a.Sampler.WrapV == b.Sampler.WrapV && a.Sampler.WrapW == b.Sampler.WrapW &&
+                   a.Sampler.GenerateMipmaps == b.Sampler.GenerateMipmaps;
+        }
+    } // namespace
+
+    RHITextureHandle RenderGraphResources::GetTexture(const RenderGraphTexture texture) const {
+        return graph.GetTexture(texture);
+    }
+
+    RenderGraphPassBuilder& RenderGraphPassBuilder::Read(const RenderGraphTexture texture, const TextureState state) {
+        graph.addAccess(passIndex, texture, state, true, false);
+        return *this;
+    }
+
+    RenderGraphPassBuilder& RenderGraphPassBuilder::Write(const RenderGraphTexture texture, const TextureState state) {
+        graph.addAccess(passIndex, texture, state, false, true);
+        return *this;
+    }
+
+    RenderGraphPassBuilder& RenderGraphPassBuilder::ColorAttachment(const RenderGraphTexture texture,
+                                                                    const LoadOp load,
+                                                                    const ClearValue& clear,
+                                                                    const StoreOp store,
+                                                                    const RenderGraphTexture resolveTarget) {
+        auto& pass = graph.passes[passIndex];
+        if (texture.Index >= graph.textures.size() ||
+            (resolveTarget.IsValid() && resolveTarget.Index >= graph.textures.size())) {
+            spdlog::error("RenderGraph: pass '{}' uses an invalid color attachment", pass.Name);
+            return *this;
+        }
+        if (pass.ColorAttachmentCount >= MaxColorAttachments) {
+            spdlog::error("RenderGraph: pass '{}' has more than {} color attachments", pass.Name, MaxColorAttachments);
+            return *this;
+        }
+        pass.ColorAttachments[pass.ColorAttachmentCount++] = {
+            .Texture = texture.Index,
+            .ResolveTexture = resolveTarget.Index,
+            .Load = load,
+            .Store = store,
+            .Clear = clear,
+        };
+        graph.addAccess(passIndex, texture, TextureState::ColorAttachment, load == LoadOp::Load, true);
+        if (resolveTarget.IsValid()) {
+            graph.addAccess(passIndex, resolveTarget, TextureState::ColorAttachment, false, true);
+        }
+        return *this;
+    }
+
+    RenderGraphPassBuilder& RenderGraphPassBuilder::DepthAttachment(const RenderGraphTexture texture,
+                                                                    const LoadOp load,
+                                                                    const ClearValue& clear,
+                                                                    const StoreOp store) {
+        auto& pass = graph.passes[passIndex];
+        if (texture.Index >= graph.textures.size()) {
+            spdlog::error("RenderGraph: pass '{}' uses an invalid depth attachment", pass.Name);
+            return *this;
+        }
+        pass.DepthAttachment = {
+            .Texture = texture.Index,
+            .Load = load,
+            .Store = store,
+            .Clear = clear,
+        };
+        graph.addAccess(passIndex, texture, TextureState::DepthStencilAttachment, load == LoadOp::Load, true);
+        return *this;
+    }
+
+    RenderGraphPassBuilder& RenderGraphPassBuilder::SideEffect() {
+        graph.passes[passIndex].bSideEffect = true;
+        return *this;
+    }
+
+    RHIRenderGraph::RHIRenderGraph(RHIDevice& device) : device(device) {}
+
+    RHIRenderGraph::~RHIRenderGraph() {
+        for (const auto& pooled : pool) {
+            device.FreeTexture(pooled.Handle);
+        }
+    }
+
+    void RHIRenderGraph::Reset() {
+        passes.clear();
+        textures.clear();
+    }
+
+    RenderGraphTexture RHIRenderGraph::ImportTexture(const RHITextureHandle& handle,
+                                                     const uint32_t width,
+                                                     const uint32_t height) {
+        if (!handle.IsValid()) {
+            spdlog::error("RenderGraph: cannot import an invalid texture handle");
+            return {};
+        }
+        textures.push_back({
+            .Descriptor = {.Width = width, .Height = height},
+            .Imported = handle,
+        });
+        return {static_cast<uint32_t>(textures.size() - 1)};
+    }
+
+    RenderGraphTexture RHIRenderGraph::CreateTexture(const TextureDescriptor& descriptor) {
+        textures.push_back({.Descriptor = descriptor});
+        return {static_cast<uint32_t>(textures.size() - 1)};
+    }
+
+    void RHIRenderGraph::MarkOutput(const RenderGraphTexture texture) {
+        if (texture.Index >= textures.size()) {
+            spdlog::error("RenderGraph: MarkOutput on an invalid texture");
+            return;
+        }
+        textures[texture.Index].bOutput = true;
+    }
+
+    void RHIRenderGraph::AddPass(std::string name,
+                                 const RenderGraphSetupFunction& setup,
+                                 RenderGraphExecuteFunction execute) {
+        auto& pass = passes.emplace_back();
+        pass.Name = std::move(name);
+        pass.Execute = std::move(execute);
+        RenderGraphPassBuilder builder(*this, static_cast<uint32_t>(passes.size() - 1));
+        setup(builder);
+    }
+
+    void RHIRenderGraph::addAccess(const uint32_t passIndex,
+                                   const RenderGraphTexture texture,
+                                   const TextureState state,
+                                   const bool bReads,
+                                   const bool bWrites) {
+        auto& pass = passes[passIndex];
+        if (texture.Index >= textures.size()) {
+            spdlog::error("RenderGraph: pass '{}' uses an invalid texture", pass.Name);
+            return;
+        }
+        pass.Accesses.push_back({
+            .Texture = texture.Index,
+            .State = state,
+            .bReads = bReads,
+            .bWrites = bWrites,
+        });
+    }
+
+    RHITextureHandle RHIRenderGraph::GetTexture(const RenderGraphTexture texture) const {
+        if (texture.Index >= textures.size()) {
+            return RHITextureHandle::Null();
+        }
+        if (textures[texture.Index].IsImported()) {
+            return textures[texture.Index].Imported;
+        }
+        if (texture.Index >= plan.PooledTextures.size() || plan.PooledTextures[texture.Index] == UINT32_MAX) {
+            return RHITextureHandle::Null();
+        }
+        return pool[plan.PooledTextures[texture.Index]].Handle;
+    }
+
+    StoreOp RHIRenderGraph::storeOpFor(const AttachmentUse& attachment) const {
+        // Nothing reads a pass-local transient afterwards, and storing would commit its memory
+        const auto poolIndex = plan.PooledTextures[attachment.Texture];
+        if (poolIndex != UINT32_MAX && has(pool[poolIndex].Descriptor.Usage, TextureUsage::Transient)) {
+            return StoreOp::DontCare;
+        }
+        return attachment.Store;
+    }
+
+    bool RHIRenderGraph::IsPassCulled(const uint32_t passIndex) const {
+        return passIndex < plan.Culled.size() && plan.Culled[passIndex];
+    }
+
+    uint64_t RHIRenderGraph::hashTopology() const {
+        // Imported handles are left out on purpose: the backbuffer changes every frame without
+        // changing the plan
+        TopologyHasher hasher;
+        hasher.Add(textures.size());
+        for (const auto& texture : textures) {
+            const auto& descriptor = texture.Descriptor;
+            hasher.Add(texture.IsImported());
+            hasher.Add(texture.bOutput);
+            hasher.Add(descriptor.Width);
+            hasher.Add(descriptor.Height);
+            hasher.Add(to_index(descriptor.Format));
+            hasher.Add(to_index(descriptor.Samples));
+            hasher.Add(to_index(descriptor.Sampler.MinFilter));
+            hasher.Add(to_index(descriptor.Sampler.MagFilter));
+            hasher.Add(to_index(descriptor.Sampler.WrapU));
+            hasher.Add(to_index(descriptor.Sampler.WrapV));
+            hasher.Add(to_index(descriptor.Sampler.WrapW));
+            hasher.Add(descriptor.Sampler.GenerateMipmaps);
+        }
+        hasher.Add(passes.size());
+        for (const auto& pass : passes) {
+            hasher.Add(pass.bSideEffect);
+            hasher.Add(pass.Accesses.size());
+            for (const auto& access : pass.Accesses) {
+                hasher.Add(access.Texture);
+                hasher.Add(to_index(access.State));
+                hasher.Add(access.bReads);
+                hasher.Add(access.bWrites);
+            }
+        }
+        return hasher.Get();
+    }
+
+    void RHIRenderGraph::compile() {
+        OZZ_PROFILE_FUNCTION;
+        const auto passCount = static_cast<uint32_t>(passes.size());
+        const auto textureCount = static_cast<uint32_t>(textures.size());
+
+        // Walk back from the textures that leave the frame and keep only the passes that
+        // contribute to them
+        plan.Culled.assign(passCount, true);
+        std::vector<bool> live(textureCount);
+        for (uint32_t i = 0; i < textureCount; ++i) {
+            live[i] = textures[i].IsImported() || textures[i].bOutput;
+        }
+        for (uint32_t passIndex = passCount; passIndex-- > 0;) {
+            const auto& pass = passes[passIndex];
+            const bool bKeep = pass.bSideEffect || std::ranges::any_of(pass.Accesses, [&](const TextureAccess& a) {
+                                   return a.bWrites && live[a.Texture];
+                               });
+            if (!bKeep) {
+                continue;
+            }
+            plan.Culled[passIndex] = false;
+            for (const auto& access : pass.Accesses) {
+                if (access.bReads) {
+                    live[access.Texture] = true;
+                }
+            }
+        }
+
+        // Lifetimes and usage of the transients over the surviving passes
+        plan.FirstUses.assign(textureCount, UINT32_MAX);
+        std::vector<uint32_t> lastUses(textureCount, 0);
+        std::vector<TextureDescriptor> descriptors(textureCount);
+        for (uint32_t i = 0; i < textureCount; ++i) {
+            descriptors[i] = textures[i].Descriptor;
+            descriptors[i].Usage = {};
+        }
+        for (uint32_t passIndex = 0; passIndex < passCount; ++passIndex) {
+            if (plan.Culled[passIndex]) {
+                continue;
+            }
+            for (const auto& access : passes[passIndex].Accesses) {
+                plan.FirstUses[access.Texture] = std::min(plan.FirstUses[access.Texture], passIndex);
+                lastUses[access.Texture] = passIndex;
+                descriptors[access.Texture].Usage |= UsageForState(access.State);
+            }
+        }
+
+        std::vector<uint32_t> order;
+        for (uint32_t i = 0; i < textureCount; ++i) {
+            if (textures[i].IsImported() || plan.FirstUses[i] == UINT32_MAX) {
+                continue;
+            }
+            if (textures[i].bOutput) {
+                lastUses[i] = passCount;
+            } else if (plan.FirstUses[i] == lastUses[i] &&
+                       !has(descriptors[i].Usage, ~(TextureUsage::ColorAttachment | TextureUsage::DepthAttachment))) {
+                // Never leaves its pass, so tilers can keep it in tile memory
+                descriptors[i].Usage |= TextureUsage::Transient;
+            }
+            order.push_back(i);
+        }
+        std::ranges::sort(order, {}, [&](const uint32_t i) { return plan.FirstUses[i]; });
+
+        // Greedy interval assignment: each transient takes the first pooled texture with the same
+        // descriptor whose current tenant is done before it starts
+        plan.PooledTextures.assign(textureCount, UINT32_MAX);
+        std::vector<bool> assigned(pool.size(), false);
+        std::vector<uint32_t> busyUntil(pool.size(), 0);
+        for (const auto textureIndex : order) {
+            const auto& descriptor = descriptors[textureIndex];
+            uint32_t poolIndex = 0;
+            for (; poolIndex < pool.size(); ++poolIndex) {
+                if (SameDescriptor(pool[poolIndex].Descriptor, descriptor) &&
+                    (!assigned[poolIndex] || busyUntil[poolIndex] < plan.FirstUses[textureIndex])) {
+                    break;
+                }
+            }
+            if (poolIndex == pool.size()) {
+                auto handle = device.CreateTexture(TextureDescriptor {descriptor});
+                if (!handle.IsValid()) {
+                    spdlog::error("RenderGraph: failed to create a {}x{} transient texture",
+                                  descriptor.Width,
+                                  descriptor.Height);
+                    continue;
+                }
+                pool.push_back({.Descriptor = descriptor, .Handle = handle});
+                assigned.push_back(false);
+                busyUntil.push_back(0);
+            }
+            plan.PooledTextures[textureIndex] = poolIndex;
+            assigned[poolIndex] = true;
+            busyUntil[poolIndex] = lastUses[textureIndex];
+        }
+
+        // Drop pooled textures the new plan does not need; FreeTexture defers the destruction
+        // until frames that still use them have retired
+        std::vector<uint32_t> remap(pool.size(), UINT32_MAX);
+        uint32_t kept = 0;
+        for (uint32_t i = 0; i < pool.size(); ++i) {
+            if (!assigned[i]) {
+                device.FreeTexture(pool[i].Handle);
+                continue;
+            }
+            remap[i] = kept;
+            pool[kept++] = pool[i];
+        }
+        pool.resize(kept);
+        for (auto& poolIndex : plan.PooledTextures) {
+            if (poolIndex != UINT32_MAX) {
+                poolIndex = remap[poolIndex];
+            }
+        }
+
+        spdlog::debug("RenderGraph: compiled {} passes ({} culled), {} transients on {} textures",
+                      passCount,
+                      std::ranges::count(plan.Culled, true),
+                      order.size(),
+                      pool.size());
+    }
+
+    void RHIRenderGraph::Execute(const RHIFrameContext& frameContext) {
+        OZZ_PROFILE_FUNCTION;
+        const auto hash = hashTopology();
+        if (hash != plan.Hash || plan.Culled.size() != passes.size()) {
+            compile();
+            plan.Hash = hash;
+        }
+
+        RenderGraphResources resources(*this);
+        for (uint32_t passIndex = 0; passIndex < passes.size(); ++passIndex) {
+            if (plan.Culled[passIndex]) {
+                continue;
+            }
+            const auto& pass = passes[passIndex];
+
+            // Transients start their lifetime with undefined contents, so the pooled texture's
+            // previous tenant is never preserved
+            for (const auto& access : pass.Accesses) {
+                if (!textures[access.Texture].IsImported() && plan.FirstUses[access.Texture] == passIndex) {
+                    const auto handle = GetTexture({access.Texture});
+                    if (handle.IsValid()) {
+                        device.TransitionTexture(frameContext, handle, TextureState::Undefined);
+                    }
+                }
+            }
+            // Barriers batch up and are recorded together by BeginRenderPass or the pass's first
+            // draw or dispatch
+            for (const auto& access : pass.Accesses) {
+                const auto handle = GetTexture({access.Texture});
+                if (handle.IsValid()) {
+                    device.TransitionTexture(frameContext, handle, access.State);
+                }
+            }
+
+            const bool bHasDepth = pass.DepthAttachment.Texture != UINT32_MAX;
+            if (pass.ColorAttachmentCount == 0 && !bHasDepth) {
+                pass.Execute(device, frameContext, resources);
+                continue;
+            }
+
+            RenderPassDescriptor renderPassDescriptor {
+                .ColorAttachmentCount = pass.ColorAttachmentCount,
+            };
+            for (uint32_t i = 0; i < pass.ColorAttachmentCount; ++i) {
+                const auto& attachment = pass.ColorAttachments[i];
+                renderPassDescriptor.ColorAttachments[i] = {
+                    .Texture = GetTexture({attachment.Texture}),
+                    .Load = attachment.Load,
+                    .Store = storeOpFor(attachment),
+                    .Clear = attachment.Clear,
+                    .Layout = TextureLayout::ColorAttachment,
+                    .ResolveTexture = GetTexture({attachment.ResolveTexture}),
+                };
+            }
+            if (bHasDepth) {
+                renderPassDescriptor.DepthAttachment = {
+                    .Texture = GetTexture({pass.DepthAttachment.Texture}),
+                    .Load = pass.DepthAttachment.Load,
+                    .Store = storeOpFor(pass.DepthAttachment),
+                    .Clear = pass.DepthAttachment.Clear,
+                    .Layout = TextureLayout::DepthStencilAttachment,
+                };
+            }
+            const auto& areaSource = textures[pass.ColorAttachmentCount > 0 ? pass.ColorAttachments[0].Texture
+                                                                            : pass.DepthAttachment.Texture];
+            renderPassDescriptor.RenderArea = {
+                .Width = areaSource.Descriptor.Width,
+                .Height = areaSource.Descriptor.Height,
+            };
+
+            device.BeginRenderPass(frameContext, renderPassDescriptor);
+            pass.Execute(device, frameContext, resources);
+            device.EndRenderPass(frameContext);
+        }
+    }
+} // namespace OZZ::rendering
@@ -29,15 +29,17 @@ namespace OZZ::rendering::slang_compile {
     //    Slang 2026.8.1 release()-crash note in slang_compile.cpp.
     //  - Linked is a live reference the caller owns; call Linked->release() when
     //    done reflecting / extracting code from it.
-    //  - VertexBlob / FragmentBlob are the entry-point code blobs for entry
-    //    point 0 (vertex) and 1 (fragment) respectively, retained for the
-    //    caller. Either may be null if that entry point was absent or its code
-    //    generation failed. Call release() on each non-null blob when done.
+    //  - VertexBlob / FragmentBlob / ComputeBlob are the entry-point code blobs
+    //    for the vertex, fragment and compute entry points, retained for the
+    //    caller. Any may be null if that entry point was absent (or not requested)
+    //    or its code generation failed. Call release() on each non-null blob when
+    //    done.
     struct SlangCompileResult {
         ::slang::ISession*        Session {nullptr};        // kept alive deliberately; TODO(slang>2026.8.1)
         ::slang::IComponentType*  Linked {nullptr};         // caller owns; release() when done
-        ISlangBlob*               VertexBlob {nullptr};     // entry point 0 code for the requested target
-        ISlangBlob*               FragmentBlob {nullptr};   // entry point 1 code for the requested target
+        ISlangBlob*               VertexBlob {nullptr};     // vertex entry point code for the requested target
+        ISlangBlob*               FragmentBlob {nullptr};   // fragment entry point code for the requested target
+        ISlangBlob*               ComputeBlob {nullptr};    // compute entry point code (CompileSlangComputeProgram only)
     };
 
     // Run the shared Slang compile pipeline for a single-module, two-entry-point
@@ -63,4 +65,16 @@ namespace OZZ::rendering::slang_compile {
         const std::string&               vertexEntryPoint   = "vertexMain",
         const std::string&               fragmentEntryPoint = "fragmentMain");
 
+    // Same pipeline for a single-entry-point compute shader. Only ComputeBlob is
+    // populated in the result; ownership and failure semantics match
+    // CompileSlangProgram.
+    std::optional<SlangCompileResult> CompileSlangComputeProgram(
+        ::slang::IGlobalSession*         globalSession,
+        SlangCompileTarget               target,
+        const std::string&               source,
+        const std::vector<ShaderDefine>& defines,
+        std::string&                     outDiagnostics,
+        ::slang::ISession*&              outSession,
+        const std::string&               computeEntryPoint = "computeMain");
+
 } // namespace OZZ::rendering::slang_compile
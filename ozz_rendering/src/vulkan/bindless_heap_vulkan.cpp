@@ -0,0 +1,225 @@
+//
+// Created by paulm on 2026-10-16.
+//
+
+#include "bindless_heap_vulkan.h"
+
+#include "ozz_rendering/rhi_descriptors.h"
+
+#include <array>
+
+#include <spdlog/spdlog.h>
+
+namespace OZZ::rendering::vk {
+    uint32_t BindlessHeapVulkan::IndexAllocator::Allocate() {
+        if (!Free.empty()) {
+            const uint32_t index = Free.back();
+            Free.pop_back();
+            return index;
+        }
+        return Next < Capacity ? Next++ : InvalidBindlessIndex;
+    }
+
+    void BindlessHeapVulkan::IndexAllocator::Release(const uint32_t index) {
+        if (index < Next) {
+            Free.push_back(index);
+        }
+    }
+
+    bool BindlessHeapVulkan::Init(VkDevice vkDevice, const uint32_t maxTextures, const uint32_t maxBuffers) {
+        device = vkDevice;
+        textureIndices = {.Capacity = maxTextures};
+        bufferIndices = {.Capacity = maxBuffers};
+
+        const std::array<VkDescriptorSetLayoutBinding, 3> bindings {{
+            {
+                .binding = BindlessTextureBinding,
+                .descriptorType = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,
+                .descriptorCount = maxTextures,
+                .stageFlags = VK_SHADER_STAGE_ALL,
+                .pImmutableSamplers = nullptr,
+            },
+            {
+                .binding = BindlessSamplerBinding,
+                .descriptorType = VK_DESCRIPTOR_TYPE_SAMPLER,
+                .descriptorCount = maxTextures,
+                .stageFlags = VK_SHADER_STAGE_ALL,
+                .pImmutableSamplers = nullptr,
+            },
+            {
+                .binding = BindlessStorageBufferBinding,
+                .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                .descriptorCount = maxBuffers,
+                .stageFlags = VK_SHADER_STAGE_ALL,
+                .pImmutableSamplers = nullptr,
+            },
+        }};
+        constexpr VkDescriptorBindingFlags BindingFlags = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT |
+                                                          VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT |
+                                                          VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT;
+        const std::array<VkDescriptorBindingFlags, 3> bindingFlags {BindingFlags, BindingFlags, BindingFlags};
+
+        const VkDescriptorSetLayoutBindingFlagsCreateInfo bindingFlagsCreateInfo {
+            .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO,
+            .pNext = nullptr,
+            .bindingCount = static_cast<uint32_t>(bindingFlags.size()),
+            .pBindingFlags = bindingFlags.data(),
+        };
+        const VkDescriptorSetLayoutCreateInfo layoutCreateInfo {
+            .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+            .pNext = &bindingFlagsCreateInfo,
+            .flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT,
+            .bindingCount = static_cast<uint32_t>(bindings.size()),
+            .pBindings = bindings.data(),
+        };
+        if (const auto result = vkCreateDescriptorSetLayout(device, &layoutCreateInfo, nullptr, &layout);
+            result != VK_SUCCESS) {
+            spdlog::error("Failed to create bindless descriptor set layout. Error: {}", static_cast<int>(result));
+            Destroy();
+            return false;
+        }
+
+        const std::array<VkDescriptorPoolSize, 3> poolSizes {{
+            {VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, maxTextures},
+            {VK_DESCRIPTOR_TYPE_SAMPLER, maxTextures},
+            {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, maxBuffers},
+        }};
+        const VkDescriptorPoolCreateInfo poolCreateInfo {
+            .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+            .flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT,
+            .maxSets = 1,
+            .poolSizeCount = static_cast<uint32_t>(poolSizes.size()),
+            .pPoolSizes = poolSizes.data(),
+        };
+        if (const auto result = vkCreateDescriptorPool(device, &poolCreateInfo, nullptr, &pool);
+            result != VK_SUCCESS) {
+            spdlog::error("Failed to create bindless descriptor pool. Error: {}", static_cast<int>(result));
+            Destroy();
+            return false;
+        }
+
+        const VkDescriptorSetAllocateInfo allocInfo {
+            .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+            .descriptorPool = pool,
+            .descriptorSetCount = 1,
+            .pSetLayouts = &layout,
+        };
+        if (const auto result = vkAllocateDescriptorSets(device, &allocInfo, &set); result != VK_SUCCESS) {
+            spdlog::error("Failed to allocate bindless descriptor set. Error: {}", static_cast<int>(result));
+            set = VK_NULL_HANDLE;
+            Destroy();
+            return false;
+        }
+
+        spdlog::trace("Bindless descriptor set created ({} textures, {} buffers)", maxTextures, maxBuffers);
+        return true;
+    }
+
+    void BindlessHeapVulkan::Destroy() {
+        if (pool != VK_NULL_HANDLE) {
+            vkDestroyDescriptorPool(device, pool, nullptr);
+            pool = VK_NULL_HANDLE;
+        }
+        if (layout != VK_NULL_HANDLE) {
+            vkDestroyDescriptorSetLayout(device, layout, nullptr);
+            layout = VK_NULL_HANDLE;
+        }
+        set = VK_NULL_HANDLE;
+        textureIndices = {};
+        bufferIndices = {};
+    }
+
+    uint32_t BindlessHeapVulkan::AddTexture(VkImageView imageView, VkSampler sampler) {
+        if (!IsEnabled()) {
+            return InvalidBindlessIndex;
+        }
+
+        std::lock_guard lock(mutex);
+        const uint32_t index = textureIndices.Allocate();
+        if (index == InvalidBindlessIndex) {
+            spdlog::error("Bindless texture capacity of {} is used up", textureIndices.Capacity);
+            return InvalidBindlessIndex;
+        }
+
+        const VkDescriptorImageInfo imageInfo {
+            .sampler = VK_NULL_HANDLE,
+            .imageView = imageView,
+            .imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+        };
+        const VkDescriptorImageInfo samplerInfo {
+            .sampler = sampler,
+            .imageView = VK_NULL_HANDLE,
+            .imageLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+        };
+        const std::array<VkWriteDescriptorSet, 2> writes {{
+            {
+                .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+                .dstSet = set,
+                .dstBinding = BindlessTextureBinding,
+                .dstArrayElement = index,
+                .descriptorCount = 1,
+                .descriptorType = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,
+                .pImageInfo = &imageInfo,
+            },
+            {
+                .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+                .dstSet = set,
+                .dstBinding = BindlessSamplerBinding,
+                .dstArrayElement = index,
+                .descriptorCount = 1,
+                .descriptorType = VK_DESCRIPTOR_TYPE_SAMPLER,
+                .pImageInfo = &samplerInfo,
+            },
+        }};
+        // A texture without a sampler only fills the image slot
+        const uint32_t writeCount = sampler != VK_NULL_HANDLE ? 2 : 1;
+        vkUpdateDescriptorSets(device, writeCount, writes.data(), 0, nullptr);
+        return index;
+    }
+
+    uint32_t BindlessHeapVulkan::AddBuffer(VkBuffer buffer) {
+        if (!IsEnabled()) {
+            return InvalidBindlessIndex;
+        }
+
+        std::lock_guard lock(mutex);
+        const uint32_t index = bufferIndices.Allocate();
+        if (index == InvalidBindlessIndex) {
+            spdlog::error("Bindless buffer capacity of {} is used up", bufferIndices.Capacity);
+            return InvalidBindlessIndex;
+        }
+
+        const VkDescriptorBufferInfo bufferInfo {
+            .buffer = buffer,
+            .offset = 0,
+            .range = VK_WHOLE_SIZE,
+        };
+        const VkWriteDescriptorSet write {
+            .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+            .dstSet = set,
+            .dstBinding = BindlessStorageBufferBinding,
+            .dstArrayElement = index,
+            .descriptorCount = 1,
+            .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+            .pBufferInfo = &bufferInfo,
+        };
+        vkUpdateDescriptorSets(device, 1, &write, 0, nullptr);
+        return index;
+    }
+
+    void BindlessHeapVulkan::RemoveTexture(const uint32_t index) {
+        if (index == InvalidBindlessIndex) {
+            return;
+        }
+        std::lock_guard lock(mutex);
+        textureIndices.Release(index);
+    }
+
+    void BindlessHeapVulkan::RemoveBuffer(const uint32_t index) {
+        if (index == InvalidBindlessIndex) {
+            return;
+        }
+        std::lock_guard lock(mutex);
+        bufferIndices.Release(index);
+    }
+} // namespace OZZ::rendering::vk
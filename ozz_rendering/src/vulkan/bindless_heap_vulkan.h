@@ -0,0 +1,56 @@
+//
+// Created by paulm on 2026-10-16.
+//
+
+#pragma once
+#include <volk.h>
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace OZZ::rendering::vk {
+    // The global bindless descriptor set: runtime arrays of sampled images, samplers and storage
+    // buffers at BindlessTextureBinding, BindlessSamplerBinding and BindlessStorageBufferBinding.
+    // Every binding is partially bound and may be updated after bind and while pending, so
+    // resources come and go while frames that index other slots are in flight. A texture's
+    // image and sampler share an index. Indices are reused once released. Thread-safe.
+    class BindlessHeapVulkan {
+    public:
+        bool Init(VkDevice device, uint32_t maxTextures, uint32_t maxBuffers);
+        void Destroy();
+
+        [[nodiscard]] bool IsEnabled() const { return set != VK_NULL_HANDLE; }
+
+        [[nodiscard]] VkDescriptorSetLayout Layout() const { return layout; }
+
+        [[nodiscard]] VkDescriptorSet Set() const { return set; }
+
+        // InvalidBindlessIndex when the heap is disabled or full
+        uint32_t AddTexture(VkImageView imageView, VkSampler sampler);
+        uint32_t AddBuffer(VkBuffer buffer);
+        // The slot must no longer be read by the GPU; its descriptor is left as it is
+        void RemoveTexture(uint32_t index);
+        void RemoveBuffer(uint32_t index);
+
+    private:
+        struct IndexAllocator {
+            uint32_t Capacity {0};
+            uint32_t Next {0};
+            std::vector<uint32_t> Free {};
+
+            uint32_t Allocate();
+            void Release(uint32_t index);
+        };
+
+        VkDevice device {VK_NULL_HANDLE};
+        VkDescriptorSetLayout layout {VK_NULL_HANDLE};
+        VkDescriptorPool pool {VK_NULL_HANDLE};
+        VkDescriptorSet set {VK_NULL_HANDLE};
+
+        // Guards the index allocators and writes to set
+        std::mutex mutex;
+        IndexAllocator textureIndices {};
+        IndexAllocator bufferIndices {};
+    };
+} // namespace OZZ::rendering::vk
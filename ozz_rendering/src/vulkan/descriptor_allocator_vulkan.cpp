@@ -0,0 +1,276 @@
+//
+// Created by paulm on 2026-10-16.
+//
+
+#include "descriptor_allocator_vulkan.h"
+
+#include <algorithm>
+#include <utility>
+
+#include <spdlog/spdlog.h>
+
+namespace OZZ::rendering::vk {
+    namespace {
+        // Never reused, so a thread's cached pool can not outlive its allocator and be mistaken
+        // for a pool of a later allocator at the same address
+        std::atomic<uint64_t> nextAllocatorId {1};
+
+        std::pair<uint64_t, DescriptorPoolVulkan*>& threadPoolCache() {
+            thread_local std::pair<uint64_t, DescriptorPoolVulkan*> cached {0, nullptr};
+            return cached;
+        }
+
+        // Expires when the thread exits, which gives up its claim on a pool
+        const std::shared_ptr<void>& threadToken() {
+            thread_local const std::shared_ptr<void> token = std::make_shared<char>();
+            return token;
+        }
+    } // namespace
+
+    DescriptorCountsVulkan CountDescriptors(std::span<const VkDescriptorSetLayoutBinding> bindings) {
+        DescriptorCountsVulkan counts {};
+        for (const auto& binding : bindings) {
+            const auto it = std::ranges::find(PooledDescriptorTypes, binding.descriptorType);
+            if (it == PooledDescriptorTypes.end()) {
+                spdlog::error("Descriptor type {} is not pooled", static_cast<int>(binding.descriptorType));
+                continue;
+            }
+            counts[it - PooledDescriptorTypes.begin()] += binding.descriptorCount;
+        }
+        return counts;
+    }
+
+    DescriptorAllocatorVulkan::DescriptorAllocatorVulkan()
+        : allocatorId(nextAllocatorId.fetch_add(1, std::memory_order_relaxed)) {}
+
+    void DescriptorAllocatorVulkan::Init(VkDevice vkDevice) {
+        device = vkDevice;
+    }
+
+    void DescriptorAllocatorVulkan::Destroy() {
+        std::lock_guard lock(poolsMutex);
+        for (const auto& pool : pools) {
+            vkDestroyDescriptorPool(device, pool->Pool, nullptr);
+        }
+        if (!pools.empty()) {
+            spdlog::trace("Destroyed {} descriptor pools", pools.size());
+        }
+        pools.clear();
+        nextPoolSets = InitialPoolSets;
+    }
+
+    std::optional<RHIDescriptorSetVulkan>
+    DescriptorAllocatorVulkan::Allocate(const RHIDescriptorSetLayoutVulkan& layout) {
+        auto& cached = threadPoolCache();
+        DescriptorPoolVulkan* pool = cached.first == allocatorId ? cached.second : nullptr;
+
+        // A pool let go of by another thread may lack room for this layout, so the last attempt
+        // always goes to a new pool sized for it, which only fails when the device is out of memory
+        constexpr int MaxAttempts = 3;
+        for (int attempt = 0; attempt < MaxAttempts; ++attempt) {
+            if (!pool || pool->bExhausted.load(std::memory_order_relaxed)) {
+                pool = claimPool(pool, layout.DescriptorCounts, attempt == MaxAttempts - 1);
+                if (!pool) {
+                    return std::nullopt;
+                }
+                cached = {allocatorId, pool};
+            }
+
+            const VkDescriptorSetAllocateInfo allocInfo {
+                .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+                .descriptorPool = pool->Pool,
+                .descriptorSetCount = 1,
+                .pSetLayouts = &layout.Layout,
+            };
+            VkDescriptorSet set {VK_NULL_HANDLE};
+            std::unique_lock lock(pool->Mutex);
+            const auto result = vkAllocateDescriptorSets(device, &allocInfo, &set);
+            if (result == VK_SUCCESS) {
+                ++pool->LiveSets;
+                lock.unlock();
+                allocatedSets.fetch_add(1, std::memory_order_relaxed);
+                for (size_t i = 0; i < layout.DescriptorCounts.size(); ++i) {
+                    allocatedDescriptors[i].fetch_add(layout.DescriptorCounts[i], std::memory_order_relaxed);
+                }
+                return RHIDescriptorSetVulkan {.Set = set, .Pool = pool};
+            }
+            if (result != VK_ERROR_OUT_OF_POOL_MEMORY && result != VK_ERROR_FRAGMENTED_POOL) {
+                spdlog::error("Failed to allocate descriptor set. Error: {}", static_cast<int>(result));
+                return std::nullopt;
+            }
+            pool->bExhausted.store(true, std::memory_order_relaxed);
+        }
+
+        spdlog::error("Failed to allocate descriptor set from a new descriptor pool");
+        return std::nullopt;
+    }
+
+    void DescriptorAllocatorVulkan::Free(const RHIDescriptorSetVulkan& descriptorSet) {
+        if (descriptorSet.Set == VK_NULL_HANDLE || !descriptorSet.Pool) {
+            return;
+        }
+        auto& pool = *descriptorSet.Pool;
+        if (pool.bTransient) {
+            return;
+        }
+        std::lock_guard lock(pool.Mutex);
+        vkFreeDescriptorSets(device, pool.Pool, 1, &descriptorSet.Set);
+        --pool.LiveSets;
+        pool.bExhausted.store(false, std::memory_order_relaxed);
+    }
+
+    size_t DescriptorAllocatorVulkan::PoolCount() const {
+        std::lock_guard lock(poolsMutex);
+        return pools.size();
+    }
+
+    DescriptorPoolVulkan* DescriptorAllocatorVulkan::claimPool(DescriptorPoolVulkan* previous,
+                                                               const DescriptorCountsVulkan& counts,
+                                                               const bool bNewPool) {
+        const auto& token = threadToken();
+        std::lock_guard lock(poolsMutex);
+        if (previous) {
+            previous->Owner.reset();
+        }
+
+        // Pools other threads let go of, or left behind when they exited, keep getting room back
+        // as their sets are freed
+        if (!bNewPool) {
+            for (const auto& pool : pools) {
+                if (pool->Owner.expired() && pool.get() != previous &&
+                    !pool->bExhausted.load(std::memory_order_relaxed)) {
+                    pool->Owner = token;
+                    return pool.get();
+                }
+            }
+        }
+
+        auto* pool = createPool(counts);
+        if (pool) {
+            pool->Owner = token;
+        }
+        return pool;
+    }
+
+    DescriptorPoolVulkan* DescriptorAllocatorVulkan::createPool(const DescriptorCountsVulkan& counts) {
+        const uint32_t maxSets = nextPoolSets;
+        const uint64_t observedSets = allocatedSets.load(std::memory_order_relaxed);
+
+        // Until there is usage to go by, give every type one descriptor per set
+        std::vector<VkDescriptorPoolSize> poolSizes;
+        for (size_t i = 0; i < PooledDescriptorTypes.size(); ++i) {
+            const uint64_t observed = allocatedDescriptors[i].load(std::memory_order_relaxed);
+            uint64_t descriptorCount =
+                observedSets == 0 ? maxSets : (observed * maxSets + observedSets - 1) / observedSets;
+            // The set that asked for the pool has to fit no matter what was observed
+            descriptorCount = std::max<uint64_t>(descriptorCount, counts[i]);
+            if (descriptorCount > 0) {
+                poolSizes.push_back({PooledDescriptorTypes[i], static_cast<uint32_t>(descriptorCount)});
+            }
+        }
+        if (poolSizes.empty()) {
+            // Sets of empty layouts still need a pool with at least one size entry
+            poolSizes.push_back({VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1});
+        }
+
+        const VkDescriptorPoolCreateInfo poolCreateInfo {
+            .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+            .flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT,
+            .maxSets = maxSets,
+            .poolSizeCount = static_cast<uint32_t>(poolSizes.size()),
+            .pPoolSizes = poolSizes.data(),
+        };
+
+        VkDescriptorPool vkPool {VK_NULL_HANDLE};
+        if (const auto result = vkCreateDescriptorPool(device, &poolCreateInfo, nullptr, &vkPool);
+            result != VK_SUCCESS) {
+            spdlog::error("Failed to create descriptor pool. Error: {}", static_cast<int>(result));
+            return nullptr;
+        }
+
+        auto& pool = pools.emplace_back(std::make_unique<DescriptorPoolVulkan>());
+        pool->Pool = vkPool;
+        nextPoolSets = std::min(nextPoolSets * 2, MaxPoolSets);
+        spdlog::trace("Descriptor pool {} created with {} sets", pools.size(), maxSets);
+        return pool.get();
+    }
+
+    void TransientDescriptorArenaVulkan::Destroy(VkDevice device) {
+        for (const auto& pool : pools) {
+            vkDestroyDescriptorPool(device, pool->Pool, nullptr);
+        }
+        pools.clear();
+        currentPool = 0;
+    }
+
+    std::optional<RHIDescriptorSetVulkan>
+    TransientDescriptorArenaVulkan::Allocate(VkDevice device, const RHIDescriptorSetLayoutVulkan& layout) {
+        while (true) {
+            bool bNewPool = false;
+            if (currentPool == pools.size()) {
+                if (!createPool(device, layout.DescriptorCounts)) {
+                    return std::nullopt;
+                }
+                bNewPool = true;
+            }
+            auto& pool = *pools[currentPool];
+
+            const VkDescriptorSetAllocateInfo allocInfo {
+                .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+                .descriptorPool = pool.Pool,
+                .descriptorSetCount = 1,
+                .pSetLayouts = &layout.Layout,
+            };
+            VkDescriptorSet set {VK_NULL_HANDLE};
+            const auto result = vkAllocateDescriptorSets(device, &allocInfo, &set);
+            if (result == VK_SUCCESS) {
+                ++pool.LiveSets;
+                return RHIDescriptorSetVulkan {.Set = set, .Pool = &pool};
+            }
+            // A pool made for this layout that can not hold it will not do better next time
+            if (bNewPool || (result != VK_ERROR_OUT_OF_POOL_MEMORY && result != VK_ERROR_FRAGMENTED_POOL)) {
+                spdlog::error("Failed to allocate transient descriptor set. Error: {}", static_cast<int>(result));
+                return std::nullopt;
+            }
+            ++currentPool;
+        }
+    }
+
+    void TransientDescriptorArenaVulkan::Reset(VkDevice device) {
+        for (const auto& pool : pools) {
+            if (pool->LiveSets > 0) {
+                vkResetDescriptorPool(device, pool->Pool, 0);
+                pool->LiveSets = 0;
+            }
+        }
+        currentPool = 0;
+    }
+
+    DescriptorPoolVulkan* TransientDescriptorArenaVulkan::createPool(VkDevice device,
+                                                                     const DescriptorCountsVulkan& counts) {
+        std::vector<VkDescriptorPoolSize> poolSizes;
+        for (size_t i = 0; i < PooledDescriptorTypes.size(); ++i) {
+            poolSizes.push_back({PooledDescriptorTypes[i], std::max(PoolSets * DescriptorsPerSet, counts[i])});
+        }
+
+        const VkDescriptorPoolCreateInfo poolCreateInfo {
+            .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+            .maxSets = PoolSets,
+            .poolSizeCount = static_cast<uint32_t>(poolSizes.size()),
+            .pPoolSizes = poolSizes.data(),
+        };
+
+        VkDescriptorPool vkPool {VK_NULL_HANDLE};
+        if (const auto result = vkCreateDescriptorPool(device, &poolCreateInfo, nullptr, &vkPool);
+            result != VK_SUCCESS) {
+            spdlog::error("Failed to create transient descriptor pool. Error: {}", static_cast<int>(result));
+            return nullptr;
+        }
+
+        auto& pool = pools.emplace_back(std::make_unique<DescriptorPoolVulkan>());
+        pool->Pool = vkPool;
+        pool->bTransient = true;
+        spdlog::trace("Transient descriptor pool {} created with {} sets", pools.size(), PoolSets);
+        return pool.get();
+    }
+} // namespace OZZ::rendering::vk
@@ -0,0 +1,148 @@
+//
+// Created by paulm on 2026-10-16.
+//
+
+#pragma once
+#include <volk.h>
+
+#include <vk_mem_alloc.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace OZZ::rendering::vk {
+    // Descriptor types the pools hold; every type ConvertDescriptorTypeToVulkan can produce
+    inline constexpr std::array<VkDescriptorType, 8> PooledDescriptorTypes {
+        VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+        VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+        VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+        VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,
+        VK_DESCRIPTOR_TYPE_SAMPLER,
+        VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+        VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC,
+        VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC,
+    };
+
+    // Descriptors of each PooledDescriptorTypes entry one set needs
+    using DescriptorCountsVulkan = std::array<uint32_t, PooledDescriptorTypes.size()>;
+
+    DescriptorCountsVulkan CountDescriptors(std::span<const VkDescriptorSetLayoutBinding> bindings);
+
+    // Binding offset of a binding number the set layout does not have
+    inline constexpr VkDeviceSize InvalidBindingOffset = ~VkDeviceSize {0};
+
+    struct RHIDescriptorSetLayoutVulkan {
+        VkDescriptorSetLayout Layout {VK_NULL_HANDLE};
+        DescriptorCountsVulkan DescriptorCounts {};
+        // Created with DESCRIPTOR_BUFFER_BIT_EXT: its sets live in the device's descriptor
+        // buffer instead of a pool, Size bytes each
+        bool bDescriptorBuffer {false};
+        VkDeviceSize Size {0};
+        // Offset of each binding within a set, indexed by binding number
+        std::vector<VkDeviceSize> BindingOffsets {};
+    };
+
+    struct DescriptorPoolVulkan {
+        VkDescriptorPool Pool {VK_NULL_HANDLE};
+        // Guards allocating from and freeing to Pool, and updates of the sets allocated from it,
+        // which must not race with their free
+        std::mutex Mutex;
+        uint32_t LiveSets {0};
+        // An allocation failed for lack of space; cleared again when a set is freed
+        std::atomic<bool> bExhausted {false};
+        // Liveness token of the thread that allocates from this pool, if any. It expires when
+        // that thread exits, which frees the pool for others. Guarded by the allocator's pools mutex.
+        std::weak_ptr<void> Owner {};
+        // Owned by a TransientDescriptorArenaVulkan, which resets it wholesale; its sets are
+        // never freed one by one
+        bool bTransient {false};
+    };
+
+    struct RHIDescriptorSetVulkan {
+        VkDescriptorSet Set {VK_NULL_HANDLE};
+        DescriptorPoolVulkan* Pool {nullptr};
+
+        // Sets of descriptor buffer layouts have no Set or Pool, just their range of the
+        // descriptor buffer and the layout's binding offsets
+        VmaVirtualAllocation BufferAllocation {VK_NULL_HANDLE};
+        uint32_t BufferIndex {0};
+        VkDeviceSize BufferOffset {0};
+        VkDeviceSize BufferSize {0};
+        std::vector<VkDeviceSize> BindingOffsets {};
+
+        // Allocated by AllocateTransientDescriptorSet; only these may reference Stream buffers,
+        // which resolve to the copy of the frame slot the set was allocated for
+        bool bTransient {false};
+        uint32_t FrameIndex {0};
+    };
+
+    // Hands out descriptor sets from a growing list of pools. Each thread claims a pool of its
+    // own and allocates from it without contending with other threads; a thread whose pool
+    // runs out claims an unclaimed pool that has room again or chains a new one. The claim of
+    // a thread that exits lapses with it. New pools
+    // hold twice the sets of the last one, up to MaxPoolSets, with the descriptor mix observed
+    // so far. Sets go back to the pool they came from. Thread-safe.
+    class DescriptorAllocatorVulkan {
+    public:
+        static constexpr uint32_t InitialPoolSets = 64;
+        static constexpr uint32_t MaxPoolSets = 4096;
+
+        DescriptorAllocatorVulkan();
+
+        void Init(VkDevice device);
+        // Destroys every pool; every set must have been freed or abandoned by then
+        void Destroy();
+
+        std::optional<RHIDescriptorSetVulkan> Allocate(const RHIDescriptorSetLayoutVulkan& layout);
+        void Free(const RHIDescriptorSetVulkan& descriptorSet);
+
+        [[nodiscard]] size_t PoolCount() const;
+
+    private:
+        // Gives up the claim on previous, if any, and claims an unclaimed pool that is not known
+        // to be full, or a new one with room for at least counts
+        DescriptorPoolVulkan*
+        claimPool(DescriptorPoolVulkan* previous, const DescriptorCountsVulkan& counts, bool bNewPool);
+        DescriptorPoolVulkan* createPool(const DescriptorCountsVulkan& counts);
+
+        const uint64_t allocatorId;
+        VkDevice device {VK_NULL_HANDLE};
+
+        mutable std::mutex poolsMutex;
+        std::vector<std::unique_ptr<DescriptorPoolVulkan>> pools;
+        uint32_t nextPoolSets {InitialPoolSets};
+
+        // Lifetime totals of successful allocations, the basis for sizing new pools
+        std::atomic<uint64_t> allocatedSets {0};
+        std::array<std::atomic<uint64_t>, PooledDescriptorTypes.size()> allocatedDescriptors {};
+    };
+
+    // Descriptor sets that live for one frame slot. Its pools are created without
+    // FREE_DESCRIPTOR_SET_BIT and reset wholesale once the slot's previous frame has retired,
+    // then kept for later frames, so a steady frame creates no pools. Not thread-safe.
+    class TransientDescriptorArenaVulkan {
+    public:
+        static constexpr uint32_t PoolSets = 256;
+        // Descriptors of every pooled type a pool holds per set
+        static constexpr uint32_t DescriptorsPerSet = 4;
+
+        void Destroy(VkDevice device);
+
+        std::optional<RHIDescriptorSetVulkan> Allocate(VkDevice device, const RHIDescriptorSetLayoutVulkan& layout);
+        // Returns every set to the pools; none of them may still be in use by the GPU
+        void Reset(VkDevice device);
+
+    private:
+        DescriptorPoolVulkan* createPool(VkDevice device, const DescriptorCountsVulkan& counts);
+
+        std::vector<std::unique_ptr<DescriptorPoolVulkan>> pools;
+        // Pools before this one ran out since the last reset; those after it are empty
+        size_t currentPool {0};
+    };
+} // namespace OZZ::rendering::vk
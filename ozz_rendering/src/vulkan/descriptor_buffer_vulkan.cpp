@@ -0,0 +1,240 @@
+//
+// Created by paulm on 2026-10-16.
+//
+
+#include "descriptor_buffer_vulkan.h"
+
+#include <algorithm>
+
+#include <spdlog/spdlog.h>
+
+namespace OZZ::rendering::vk {
+    bool DescriptorBufferVulkan::Init(VkDevice vkDevice,
+                                      VmaAllocator vmaAllocator,
+                                      const VkPhysicalDeviceDescriptorBufferPropertiesEXT& deviceProperties,
+                                      const VkDeviceSize size) {
+        device = vkDevice;
+        allocator = vmaAllocator;
+        properties = deviceProperties;
+        properties.pNext = nullptr;
+
+        // Samplers and resources share each buffer, so both ranges bound it
+        bufferSize = std::min({size,
+                               properties.maxResourceDescriptorBufferRange,
+                               properties.maxSamplerDescriptorBufferRange});
+        if (bufferSize < size) {
+            spdlog::warn("Descriptor buffer clamped to {} bytes", bufferSize);
+        }
+
+        // Every buffer stays bound, and each one counts as a sampler and a resource buffer
+        // against both the binding limits and the address space limits
+        const VkDeviceSize addressSpace = std::min({properties.descriptorBufferAddressSpaceSize,
+                                                    properties.resourceDescriptorBufferAddressSpaceSize,
+                                                    properties.samplerDescriptorBufferAddressSpaceSize});
+        const auto addressSpaceBuffers =
+            static_cast<uint32_t>(std::min<VkDeviceSize>(addressSpace / bufferSize, MaxBuffers));
+        maxBufferCount = std::min({MaxBuffers,
+                                   properties.maxDescriptorBufferBindings,
+                                   properties.maxResourceDescriptorBufferBindings,
+                                   properties.maxSamplerDescriptorBufferBindings,
+                                   addressSpaceBuffers});
+        if (maxBufferCount == 0) {
+            spdlog::error("Descriptor buffer of {} bytes does not fit the device's limits", bufferSize);
+            return false;
+        }
+
+        std::lock_guard lock(mutex);
+        return addBuffer();
+    }
+
+    void DescriptorBufferVulkan::Destroy() {
+        const uint32_t count = bufferCount.exchange(0, std::memory_order_acq_rel);
+        for (uint32_t i = 0; i < count; ++i) {
+            destroyBuffer(allocator, buffers[i]);
+        }
+    }
+
+    bool DescriptorBufferVulkan::addBuffer() {
+        const uint32_t index = bufferCount.load(std::memory_order_relaxed);
+        auto& target = buffers[index];
+
+        const VkBufferCreateInfo bufferCreateInfo {
+            .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .size = bufferSize,
+            .usage = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT |
+                     VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
+            .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+            .queueFamilyIndexCount = 0,
+            .pQueueFamilyIndices = nullptr,
+        };
+
+        const VmaAllocationCreateInfo allocationCreateInfo {
+            .flags = VMA_ALLOCATION_CREATE_MAPPED_BIT,
+            .usage = VMA_MEMORY_USAGE_CPU_TO_GPU,
+            .requiredFlags = 0,
+            .preferredFlags = 0,
+            .memoryTypeBits = 0,
+            .pool = VK_NULL_HANDLE,
+            .pUserData = nullptr,
+        };
+
+        // Set offsets are relative to the buffer's address, which has to be aligned like them
+        if (const auto result = vmaCreateBufferWithAlignment(allocator,
+                                                             &bufferCreateInfo,
+                                                             &allocationCreateInfo,
+                                                             properties.descriptorBufferOffsetAlignment,
+                                                             &target.Handle,
+                                                             &target.Allocation,
+                                                             &target.AllocationInfo);
+            result != VK_SUCCESS) {
+            spdlog::error("Failed to create {} byte descriptor buffer. Error: {}",
+                          bufferSize,
+                          static_cast<int>(result));
+            target = {};
+            return false;
+        }
+
+        const VkBufferDeviceAddressInfo addressInfo {
+            .sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO,
+            .pNext = nullptr,
+            .buffer = target.Handle,
+        };
+        target.Address = vkGetBufferDeviceAddress(device, &addressInfo);
+
+        const VmaVirtualBlockCreateInfo blockCreateInfo {
+            .size = bufferSize,
+            .flags = 0,
+            .pAllocationCallbacks = nullptr,
+        };
+        if (const auto result = vmaCreateVirtualBlock(&blockCreateInfo, &target.Block); result != VK_SUCCESS) {
+            spdlog::error("Failed to create descriptor buffer virtual block. Error: {}", static_cast<int>(result));
+            destroyBuffer(allocator, target);
+            return false;
+        }
+
+        bufferCount.store(index + 1, std::memory_order_release);
+        spdlog::trace("Descriptor buffer {} created ({} bytes)", index, bufferSize);
+        return true;
+    }
+
+    void DescriptorBufferVulkan::destroyBuffer(VmaAllocator vmaAllocator, Buffer& buffer) {
+        if (buffer.Block != VK_NULL_HANDLE) {
+            // Sets abandoned at shutdown still hold allocations, which the block would report
+            vmaClearVirtualBlock(buffer.Block);
+            vmaDestroyVirtualBlock(buffer.Block);
+        }
+        if (buffer.Handle != VK_NULL_HANDLE) {
+            vmaDestroyBuffer(vmaAllocator, buffer.Handle, buffer.Allocation);
+        }
+        buffer = {};
+    }
+
+    std::optional<DescriptorBufferRangeVulkan> DescriptorBufferVulkan::Allocate(const VkDeviceSize size) {
+        if (!IsEnabled()) {
+            return std::nullopt;
+        }
+
+        // Sets of empty layouts still get a range, so every buffer set has an allocation
+        const VmaVirtualAllocationCreateInfo allocationCreateInfo {
+            .size = std::max<VkDeviceSize>(size, properties.descriptorBufferOffsetAlignment),
+            .alignment = properties.descriptorBufferOffsetAlignment,
+            .flags = 0,
+            .pUserData = nullptr,
+        };
+
+        DescriptorBufferRangeVulkan range {};
+        std::lock_guard lock(mutex);
+        // Newest buffer first: older ones only have room where sets were freed
+        for (uint32_t i = bufferCount.load(std::memory_order_relaxed); i-- > 0;) {
+            if (vmaVirtualAllocate(buffers[i].Block, &allocationCreateInfo, &range.Allocation, &range.Offset) ==
+                VK_SUCCESS) {
+                range.Buffer = i;
+                return range;
+            }
+        }
+
+        const uint32_t index = bufferCount.load(std::memory_order_relaxed);
+        if (index == maxBufferCount) {
+            spdlog::error("Descriptor buffers have no room left for a {} byte descriptor set ({} buffers of {} bytes "
+                          "in use; raise DescriptorBufferSize)",
+                          size,
+                          index,
+                          bufferSize);
+            return std::nullopt;
+        }
+        if (!addBuffer()) {
+            return std::nullopt;
+        }
+        if (const auto result =
+                vmaVirtualAllocate(buffers[index].Block, &allocationCreateInfo, &range.Allocation, &range.Offset);
+            result != VK_SUCCESS) {
+            spdlog::error("A {} byte descriptor set does not fit a {} byte descriptor buffer", size, bufferSize);
+            return std::nullopt;
+        }
+        range.Buffer = index;
+        return range;
+    }
+
+    void DescriptorBufferVulkan::Free(const uint32_t bufferIndex, VmaVirtualAllocation virtualAllocation) {
+        if (virtualAllocation == VK_NULL_HANDLE) {
+            return;
+        }
+        std::lock_guard lock(mutex);
+        if (bufferIndex < bufferCount.load(std::memory_order_relaxed)) {
+            vmaVirtualFree(buffers[bufferIndex].Block, virtualAllocation);
+        }
+    }
+
+    void DescriptorBufferVulkan::Write(const uint32_t bufferIndex,
+                                       const VkDeviceSize offset,
+                                       const VkDescriptorGetInfoEXT& info) const {
+        vkGetDescriptorEXT(device,
+                           &info,
+                           descriptorSize(info.type),
+                           static_cast<uint8_t*>(buffers[bufferIndex].AllocationInfo.pMappedData) + offset);
+    }
+
+    void DescriptorBufferVulkan::Flush(const uint32_t bufferIndex,
+                                       const VkDeviceSize offset,
+                                       const VkDeviceSize size) const {
+        // No-op on host-coherent memory
+        vmaFlushAllocation(allocator, buffers[bufferIndex].Allocation, offset, size);
+    }
+
+    uint32_t DescriptorBufferVulkan::Bind(VkCommandBuffer cmd) const {
+        const uint32_t count = BufferCount();
+        std::array<VkDescriptorBufferBindingInfoEXT, MaxBuffers> bindingInfos {};
+        for (uint32_t i = 0; i < count; ++i) {
+            bindingInfos[i] = {
+                .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT,
+                .pNext = nullptr,
+                .address = buffers[i].Address,
+                .usage = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT |
+                         VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT,
+            };
+        }
+        vkCmdBindDescriptorBuffersEXT(cmd, count, bindingInfos.data());
+        return count;
+    }
+
+    size_t DescriptorBufferVulkan::descriptorSize(const VkDescriptorType type) const {
+        switch (type) {
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+                return properties.uniformBufferDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+                return properties.storageBufferDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+                return properties.combinedImageSamplerDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+                return properties.sampledImageDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_SAMPLER:
+                return properties.samplerDescriptorSize;
+            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+                return properties.storageImageDescriptorSize;
+            default:
+                return 0;
+        }
+    }
+} // namespace OZZ::rendering::vk
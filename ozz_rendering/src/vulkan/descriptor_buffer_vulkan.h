@@ -0,0 +1,82 @@
+//
+// Created by paulm on 2026-10-16.
+//
+
+#pragma once
+#include <volk.h>
+
+#include <vk_mem_alloc.h>
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <optional>
+
+namespace OZZ::rendering::vk {
+    // Where one descriptor set's descriptors live: a range of one of the descriptor buffers
+    struct DescriptorBufferRangeVulkan {
+        uint32_t Buffer {0};
+        VkDeviceSize Offset {0};
+        VmaVirtualAllocation Allocation {VK_NULL_HANDLE};
+    };
+
+    // Persistently mapped buffers holding the descriptors of every set whose layout was created
+    // for VK_EXT_descriptor_buffer. Sets are sub-allocated from a VMA virtual block per buffer,
+    // written with vkGetDescriptorEXT straight into the mapping and bound as offsets into their
+    // buffer, which holds samplers and resources alike. It starts as one buffer; when that is
+    // full, another of the same size is added, up to the number of descriptor buffers the device
+    // can bind at once. Allocate and Free are thread-safe.
+    class DescriptorBufferVulkan {
+    public:
+        static constexpr uint32_t MaxBuffers = 8;
+
+        bool Init(VkDevice device,
+                  VmaAllocator allocator,
+                  const VkPhysicalDeviceDescriptorBufferPropertiesEXT& properties,
+                  VkDeviceSize size);
+        // Every set must have been freed or abandoned by then
+        void Destroy();
+
+        [[nodiscard]] bool IsEnabled() const { return BufferCount() > 0; }
+        [[nodiscard]] uint32_t BufferCount() const { return bufferCount.load(std::memory_order_acquire); }
+
+        std::optional<DescriptorBufferRangeVulkan> Allocate(VkDeviceSize size);
+        void Free(uint32_t bufferIndex, VmaVirtualAllocation allocation);
+
+        // Writes the descriptor info describes at offset bytes into a buffer; call Flush once
+        // the set's writes are done
+        void Write(uint32_t bufferIndex, VkDeviceSize offset, const VkDescriptorGetInfoEXT& info) const;
+        void Flush(uint32_t bufferIndex, VkDeviceSize offset, VkDeviceSize size) const;
+
+        // Binds every buffer created so far to cmd, buffer i at descriptor buffer index i, and
+        // returns how many that is. Offsets set earlier on cmd are invalidated.
+        uint32_t Bind(VkCommandBuffer cmd) const;
+
+    private:
+        struct Buffer {
+            VkBuffer Handle {VK_NULL_HANDLE};
+            VmaAllocation Allocation {VK_NULL_HANDLE};
+            VmaAllocationInfo AllocationInfo {};
+            VkDeviceAddress Address {0};
+            VmaVirtualBlock Block {VK_NULL_HANDLE};
+        };
+
+        // Creates buffers[bufferCount]; the caller holds mutex
+        bool addBuffer();
+        static void destroyBuffer(VmaAllocator vmaAllocator, Buffer& buffer);
+        [[nodiscard]] size_t descriptorSize(VkDescriptorType type) const;
+
+        VkDevice device {VK_NULL_HANDLE};
+        VmaAllocator allocator {VK_NULL_HANDLE};
+        VkPhysicalDeviceDescriptorBufferPropertiesEXT properties {};
+        VkDeviceSize bufferSize {0};
+        uint32_t maxBufferCount {0};
+
+        // Entries below bufferCount never change once published, so Write, Flush and Bind read
+        // them without the lock
+        std::array<Buffer, MaxBuffers> buffers {};
+        std::atomic<uint32_t> bufferCount {0};
+        // Guards adding buffers and the virtual blocks, which VMA does not synchronize
+        std::mutex mutex;
+    };
+} // namespace OZZ::rendering::vk
@@ -12,8 +12,16 @@ namespace OZZ::rendering::vk {
         VkBuffer Buffer {VK_NULL_HANDLE};
         VmaAllocation Allocation {VK_NULL_HANDLE};
         VmaAllocationInfo AllocationInfo {};
+        // Size asked for; the allocation may be larger
+        VkDeviceSize Size {0};
+        // Set for uniform and storage buffers when descriptor buffers are in use, which
+        // reference buffers by address
+        VkDeviceAddress DeviceAddress {0};
 
         BufferUsage Usage {BufferUsage::VertexBuffer};
         BufferMemoryAccess Access {BufferMemoryAccess::GpuOnly};
+        BufferLifetime Lifetime {BufferLifetime::PerFrame};
+        // Slot in the bindless storage buffer array, UINT32_MAX if not registered; set on copy 0
+        uint32_t BindlessIndex {UINT32_MAX};
     };
 } // namespace OZZ::rendering::vk
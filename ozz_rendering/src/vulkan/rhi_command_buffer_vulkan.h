@@ -0,0 +1,79 @@
+//
+// Created by paulm on 2026-10-16.
+//
+
+#pragma once
+#include <ozz_rendering/rhi_handle.h>
+#include <ozz_rendering/rhi_pipeline_state.h>
+#include <ozz_rendering/rhi_renderpass.h>
+
+#include <array>
+#include <vector>
+#include <volk.h>
+
+namespace OZZ::rendering::vk {
+    struct RHICommandBufferVulkan {
+        VkCommandBuffer CommandBuffer {VK_NULL_HANDLE};
+        // Pool the buffer was allocated from: the frame pool for primaries, one of the
+        // per-recording-thread pools for secondaries.
+        VkCommandPool Pool {VK_NULL_HANDLE};
+        bool bIsSecondary {false};
+        // Recorded for, and submitted to, the async compute queue (BeginAsyncCompute)
+        bool bAsyncCompute {false};
+
+        // Semaphore waits added through AddQueueDependency, consumed by the next submission
+        // of this command buffer.
+        std::vector<VkSemaphoreSubmitInfo> PendingWaits {};
+
+        // True once SetGraphicsState has been called in the current render pass;
+        // reset in beginRenderPassInternal. Guards against draws inheriting stale
+        // command-buffer dynamic state (see drawInternal / drawIndexedInternal).
+        // Tracked per command buffer so forked recording contexts don't race on it.
+        bool bStateSetThisPass {false};
+
+        // Dynamic state as last recorded by SetGraphicsState, so repeated calls only emit the
+        // commands whose values changed. Vulkan dynamic state outlives render passes, so this
+        // stays valid across them; it is dropped whenever the command buffer is begun and after
+        // vkCmdExecuteCommands, both of which leave the state undefined.
+        GraphicsStateDescriptor RecordedState {};
+        bool bRecordedStateValid {false};
+        // State object RecordedState came from, or null when it was set from a descriptor
+        RHIGraphicsStateHandle RecordedStateHandle {};
+        // How many of the device's descriptor buffers are bound, and the descriptor buffer sets
+        // bound since, which are set again when a buffer added later forces a rebind. Like
+        // RecordedState, dropped whenever the command buffer is begun and after vkCmdExecuteCommands.
+        struct BoundBufferSet {
+            VkPipelineBindPoint BindPoint {VK_PIPELINE_BIND_POINT_GRAPHICS};
+            VkPipelineLayout Layout {VK_NULL_HANDLE};
+            uint32_t SetIndex {0};
+            uint32_t BufferIndex {0};
+            VkDeviceSize Offset {0};
+        };
+        uint32_t DescriptorBuffersBound {0};
+        std::vector<BoundBufferSet> BoundBufferSets {};
+
+        // Barriers recorded since the last flush, emitted together as one vkCmdPipelineBarrier2
+        // before the next command they may have to order (see flushPendingBarriers)
+        std::vector<VkImageMemoryBarrier2> PendingImageBarriers {};
+        std::vector<VkBufferMemoryBarrier2> PendingBufferBarriers {};
+
+        // Render pass currently open on this command buffer. Forked recording contexts
+        // inherit the attachment formats when forked inside a pass.
+        bool bInRenderPass {false};
+        bool bParallelRenderPass {false};
+        std::array<VkFormat, MaxColorAttachments> ColorFormats {};
+        uint32_t ColorFormatCount {0};
+        VkFormat DepthFormat {VK_FORMAT_UNDEFINED};
+        VkFormat StencilFormat {VK_FORMAT_UNDEFINED};
+        VkSampleCountFlagBits Samples {VK_SAMPLE_COUNT_1_BIT};
+    };
+
+    // A command pool for one frame slot, owned by one recording thread (forked secondaries)
+    // or by the async compute queue. Buffers are allocated once and recycled each time the
+    // frame slot comes around.
+    struct FrameCommandPool {
+        VkCommandPool Pool {VK_NULL_HANDLE};
+        std::vector<RHICommandBufferHandle> CommandBuffers {};
+        uint32_t NextFree {0};
+    };
+} // namespace OZZ::rendering::vk
@@ -8,9 +8,13 @@
 #include "utils/rhi_vulkan_types.h"
 
 #include <algorithm>
+#include <bit>
 #include <cassert>
+#include <cstring>
 #include <fstream>
+#include <numeric>
 #include <ranges>
+#include <tuple>
 #include <spdlog/spdlog.h>
 
 #include <ozz_rendering/profiling.h>
@@ -47,14 +51,27 @@ namespace OZZ::rendering::vk {
     // === Constructor / Destructor ===
     // ============================================================
 
-    RHIDeviceVulkan::RHIDeviceVulkan(const PlatformContext& context)
-        : RHIDevice(context)
-        , platformContext(context)
+    RHIDeviceVulkan::RHIDeviceVulkan(const RHIInitParams& params)
+        : RHIDevice(params.Context)
+        , platformContext(params.Context)
+        , requestedFramesInFlight(params.FramesInFlight)
+        , bUseDedicatedTransferQueue(params.UseDedicatedTransferQueue)
+        , bUseAsyncComputeQueue(params.UseAsyncComputeQueue)
+        , bBindless(params.EnableBindless)
+        , maxBindlessTextures(params.MaxBindlessTextures)
+        , maxBindlessBuffers(params.MaxBindlessBuffers)
+        , bDescriptorBuffer(params.UseDescriptorBuffer)
+        , descriptorBufferSize(std::max<VkDeviceSize>(params.DescriptorBufferSize, 1))
+        , stagingRingSize(std::max<VkDeviceSize>(params.StagingRingSize, 1))
+        , maxStagingRingSize(std::max<VkDeviceSize>(params.MaxStagingRingSize, params.StagingRingSize))
+        // Slices start on a 256 byte boundary, the largest offset alignment Vulkan allows
+        , transientSliceSize((params.TransientBufferSize + 255) / 256 * 256)
         , texturePool([this](RHITextureVulkan& texture) {
             // no allocation means something else owns this texture, so don't destroy it
             // this is the case for swapchain images, which are owned by the swapchain and just wrapped in a texture for
             // ease of use
             if (texture.Allocation != VK_NULL_HANDLE) {
+                bindlessHeap.RemoveTexture(texture.BindlessIndex);
                 vkDestroySampler(device, texture.Sampler, nullptr);
                 vkDestroyImageView(device, texture.ImageView, nullptr);
                 vmaDestroyImage(vmaAllocator, texture.Image, texture.Allocation);
@@ -62,9 +79,9 @@ namespace OZZ::rendering::vk {
                 texture.Allocation = VK_NULL_HANDLE;
             }
         })
-        , commandBufferResourcePool([this](VkCommandBuffer& commandBuffer) {
-            if (commandBufferPool) {
-                vkFreeCommandBuffers(device, commandBufferPool, 1, &commandBuffer);
+        , commandBufferResourcePool([this](RHICommandBufferVulkan& commandBuffer) {
+            if (commandBuffer.Pool != VK_NULL_HANDLE) {
+                vkFreeCommandBuffers(device, commandBuffer.Pool, 1, &commandBuffer.CommandBuffer);
             }
         })
         , shaderResourcePool([this](RHIShaderVulkan& shader) {
@@ -74,34 +91,39 @@ namespace OZZ::rendering::vk {
             }
             shader.Destroy(device);
         })
-        , bufferResourcePool([this](const std::array<RHIBufferVulkan, MaxFramesInFlight>& buffer) {
-            for (const auto buffer : buffer) {
+        , bufferResourcePool([this](const std::vector<RHIBufferVulkan>& buffers) {
+            if (!buffers.empty()) {
+                bindlessHeap.RemoveBuffer(buffers.front().BindlessIndex);
+            }
+            for (const auto& buffer : buffers) {
                 if (buffer.Buffer != VK_NULL_HANDLE) {
                     vmaDestroyBuffer(vmaAllocator, buffer.Buffer, buffer.Allocation);
                 }
             }
         })
-        , pipelineLayoutResourcePool([this](VkPipelineLayout& layout) {
-            if (layout != VK_NULL_HANDLE) {
-                vkDestroyPipelineLayout(device, layout, nullptr);
-                layout = VK_NULL_HANDLE;
+        , pipelineLayoutResourcePool([this](RHIPipelineLayoutVulkan& layout) {
+            if (layout.Layout != VK_NULL_HANDLE) {
+                vkDestroyPipelineLayout(device, layout.Layout, nullptr);
+                layout.Layout = VK_NULL_HANDLE;
             }
         })
-        , descriptorSetLayoutResourcePool([this](VkDescriptorSetLayout& layout) {
-            if (layout != VK_NULL_HANDLE) {
-                vkDestroyDescriptorSetLayout(device, layout, nullptr);
-                layout = VK_NULL_HANDLE;
+        , descriptorSetLayoutResourcePool([this](RHIDescriptorSetLayoutVulkan& layout) {
+            if (layout.Layout != VK_NULL_HANDLE) {
+                vkDestroyDescriptorSetLayout(device, layout.Layout, nullptr);
+                layout.Layout = VK_NULL_HANDLE;
             }
         })
-        , descriptorSetResourcePool([this](VkDescriptorSet& set) {
-            if (set != VK_NULL_HANDLE && descriptorPool != VK_NULL_HANDLE) {
-                // Pool free requires external synchronization on the shared descriptorPool,
-                // and must be serialized against vkUpdateDescriptorSets of the same set.
-                std::lock_guard lock(descriptorPoolMutex);
-                vkFreeDescriptorSets(device, descriptorPool, 1, &set);
-                set = VK_NULL_HANDLE;
+        , descriptorSetResourcePool([this](RHIDescriptorSetVulkan& set) {
+            // Back to the pool it came from, under that pool's mutex; transient sets go back
+            // when their arena is reset. Descriptor buffer sets give their range back.
+            if (set.BufferAllocation != VK_NULL_HANDLE) {
+                descriptorBuffer.Free(set.BufferIndex, set.BufferAllocation);
+            } else {
+                descriptorAllocator.Free(set);
             }
-        }) {
+            set = {};
+        })
+        , graphicsStatePool([](RHIGraphicsStateVulkan&) {}) {
 
         auto result = volkInitialize();
         if (result != VK_SUCCESS) {
@@ -113,12 +135,30 @@ namespace OZZ::rendering::vk {
     }
 
     RHIDeviceVulkan::~RHIDeviceVulkan() {
-        if (graphicsQueue != VK_NULL_HANDLE) {
-            vkQueueWaitIdle(graphicsQueue);
-            graphicsQueue = VK_NULL_HANDLE;
+        for (auto* queue : {&graphicsQueue, &transferQueue, &computeQueue}) {
+            if (queue->Queue != VK_NULL_HANDLE) {
+                vkQueueWaitIdle(queue->Queue);
+            }
+        }
+
+        // Staging memory lives outside the resource pools; free it while the allocator is alive.
+        // Batch command buffers go back to their queue's transient pool, so this runs before the
+        // queue handles are cleared below.
+        for (auto& batch : submittedUploadBatches) {
+            releaseUploadBatch(batch);
+        }
+        submittedUploadBatches.clear();
+        releaseUploadBatch(openUploadBatch);
+        stagingRing.Destroy();
+
+        for (auto* queue : {&graphicsQueue, &transferQueue, &computeQueue}) {
+            queue->Queue = VK_NULL_HANDLE;
         }
 
         OZZ_GPU_CONTEXT_DESTROY(tracyGpuContext);
+        if (tracyComputeContext) {
+            OZZ_GPU_CONTEXT_DESTROY(tracyComputeContext);
+        }
 
 #ifdef OZZ_SLANG_ENABLED
         if (slangGlobalSession) {
@@ -127,10 +167,14 @@ namespace OZZ::rendering::vk {
         }
 #endif
 
-        for (const auto buffer : transientCommandBuffers) {
-            vkFreeCommandBuffers(device, transientCommandBufferPool, 1, &buffer);
+        for (auto* queue : {&graphicsQueue, &transferQueue, &computeQueue}) {
+            for (const auto buffer : queue->TransientBuffers) {
+                vkFreeCommandBuffers(device, queue->TransientPool, 1, &buffer);
+            }
+            queue->TransientBuffers.clear();
         }
-        transientCommandBuffers.clear();
+        // Frees the frame primaries, every forked secondary and the async compute buffers; the
+        // per-slot pools they came from are destroyed with the submission contexts below.
         commandBufferResourcePool.Empty();
         shaderResourcePool.Empty();
         descriptorSetResourcePool.Empty();
@@ -138,21 +182,37 @@ namespace OZZ::rendering::vk {
         descriptorSetLayoutResourcePool.Empty();
         bufferResourcePool.Empty();
         texturePool.Empty();
+        graphicsStatePool.Empty();
+        descriptorBuffer.Destroy();
 
         for (auto& context : submissionContexts) {
-            if (context.InFlightFence != VK_NULL_HANDLE) {
-                vkDestroyFence(device, context.InFlightFence, nullptr);
-                context.InFlightFence = VK_NULL_HANDLE;
-            }
             if (context.AcquireImageSemaphore != VK_NULL_HANDLE) {
                 vkDestroySemaphore(device, context.AcquireImageSemaphore, nullptr);
                 context.AcquireImageSemaphore = VK_NULL_HANDLE;
             }
+            for (auto& parallelPool : context.ParallelPools) {
+                if (parallelPool.Pool != VK_NULL_HANDLE) {
+                    vkDestroyCommandPool(device, parallelPool.Pool, nullptr);
+                    parallelPool.Pool = VK_NULL_HANDLE;
+                }
+            }
+            if (context.ComputePool.Pool != VK_NULL_HANDLE) {
+                vkDestroyCommandPool(device, context.ComputePool.Pool, nullptr);
+                context.ComputePool.Pool = VK_NULL_HANDLE;
+            }
+            context.TransientDescriptors.Destroy(device);
         }
 
         submissionContexts.clear();
         spdlog::trace("cleared submission contexts");
 
+        for (auto* queue : {&graphicsQueue, &transferQueue, &computeQueue}) {
+            if (queue->Timeline != VK_NULL_HANDLE) {
+                vkDestroySemaphore(device, queue->Timeline, nullptr);
+                queue->Timeline = VK_NULL_HANDLE;
+            }
+        }
+
         if (commandBufferPool != VK_NULL_HANDLE) {
             vkResetCommandPool(device, commandBufferPool, 0);
             vkDestroyCommandPool(device, commandBufferPool, nullptr);
@@ -160,11 +220,13 @@ namespace OZZ::rendering::vk {
             commandBufferPool = VK_NULL_HANDLE;
         }
 
-        if (transientCommandBufferPool != VK_NULL_HANDLE) {
-            vkResetCommandPool(device, transientCommandBufferPool, 0);
-            vkDestroyCommandPool(device, transientCommandBufferPool, nullptr);
-            spdlog::trace("Destroyed transient command buffer pool");
-            transientCommandBufferPool = VK_NULL_HANDLE;
+        for (auto* queue : {&graphicsQueue, &transferQueue, &computeQueue}) {
+            if (queue->TransientPool != VK_NULL_HANDLE) {
+                vkResetCommandPool(device, queue->TransientPool, 0);
+                vkDestroyCommandPool(device, queue->TransientPool, nullptr);
+                spdlog::trace("Destroyed transient command buffer pool (family {})", queue->Family);
+                queue->TransientPool = VK_NULL_HANDLE;
+            }
         }
 
         for (auto semaphore : presentCompleteSemaphores) {
@@ -195,11 +257,8 @@ namespace OZZ::rendering::vk {
             vmaAllocator = VK_NULL_HANDLE;
         }
 
-        if (descriptorPool != VK_NULL_HANDLE) {
-            vkDestroyDescriptorPool(device, descriptorPool, nullptr);
-            spdlog::trace("Descriptor pool destroyed");
-            descriptorPool = VK_NULL_HANDLE;
-        }
+        descriptorAllocator.Destroy();
+        bindlessHeap.Destroy();
 
         if (device != VK_NULL_HANDLE) {
             vkDestroyDevice(device, nullptr);
@@ -261,6 +320,13 @@ namespace OZZ::rendering::vk {
             failureMessage();
             return false;
         }
+        graphicsQueue.Family = physicalDevices.SelectedQueueFamily();
+        if (bUseDedicatedTransferQueue && physicalDevices.SelectTransferQueueFamily()) {
+            transferQueue.Family = physicalDevices.TransferQueueFamily();
+        }
+        if (bUseAsyncComputeQueue && physicalDevices.SelectComputeQueueFamily()) {
+            computeQueue.Family = physicalDevices.ComputeQueueFamily();
+        }
 
         if (!createDevice()) {
             failureMessage();
@@ -296,8 +362,11 @@ namespace OZZ::rendering::vk {
             .vkGetDeviceImageMemoryRequirements = vkGetDeviceImageMemoryRequirements,
         };
 
+        // Descriptor buffers reference buffers by device address
+        const VmaAllocatorCreateFlags allocatorFlags =
+            bDescriptorBuffer ? VMA_ALLOCATOR_CREATE_BUFFER_DEVICE_ADDRESS_BIT : VmaAllocatorCreateFlags {0};
         VmaAllocatorCreateInfo allocatorCreateInfo {
-            .flags = 0,
+            .flags = allocatorFlags,
             .physicalDevice = physicalDevices.SelectedDevice().Device,
             .device = device,
             .pVulkanFunctions = &vulkanFunctions,
@@ -310,6 +379,19 @@ namespace OZZ::rendering::vk {
             return false;
         }
 
+        const VkPhysicalDeviceMemoryProperties* memoryProperties = nullptr;
+        vmaGetMemoryProperties(vmaAllocator, &memoryProperties);
+        for (uint32_t i = 0; i < memoryProperties->memoryTypeCount; ++i) {
+            if (memoryProperties->memoryTypes[i].propertyFlags & VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT) {
+                bLazilyAllocatedMemory = true;
+            }
+        }
+        spdlog::trace("Lazily allocated memory: {}", bLazilyAllocatedMemory);
+
+        // Not fatal: uploads fall back to dedicated staging buffers, and the ring is retried
+        // the next time one does not fit
+        stagingRing.Init(vmaAllocator, stagingRingSize);
+
         if (!createCommandBufferPool()) {
             failureMessage();
             return false;
@@ -320,6 +402,17 @@ namespace OZZ::rendering::vk {
             return false;
         }
 
+        // Creating a texture may submit one-off commands, which signal the queue's timeline and
+        // are tracked by the submission contexts, so both exist before the first texture. The
+        // swapchain itself only wraps its images; its depth textures come once the contexts,
+        // sized by the swapchain image count, are in place.
+        for (auto* queue : {&graphicsQueue, &transferQueue, &computeQueue}) {
+            if (queue->Queue != VK_NULL_HANDLE && !createTimelineSemaphore(*queue)) {
+                failureMessage();
+                return false;
+            }
+        }
+
         if (!createSwapchain()) {
             failureMessage();
             return false;
@@ -330,12 +423,31 @@ namespace OZZ::rendering::vk {
             return false;
         }
 
-        if (!createDescriptorPool()) {
+        if (!createSwapchainDepthTextures()) {
+            failureMessage();
+            return false;
+        }
+
+        if (!createTransientBuffer()) {
             failureMessage();
             return false;
         }
 
-        // Create Tracy GPU profiling context
+        descriptorAllocator.Init(device);
+        // Not fatal either: every set comes from the descriptor pools instead
+        if (bDescriptorBuffer &&
+            !descriptorBuffer.Init(device,
+                                   vmaAllocator,
+                                   physicalDevices.SelectedDevice().DescriptorBufferProperties,
+                                   descriptorBufferSize)) {
+            bDescriptorBuffer = false;
+        }
+        // Not fatal: GetBindlessIndex reports no index and bindless shaders fail to create
+        if (bBindless && !bindlessHeap.Init(device, maxBindlessTextures, maxBindlessBuffers)) {
+            bBindless = false;
+        }
+
+        // Create Tracy GPU profiling contexts
         {
             VkCommandBufferAllocateInfo allocInfo {
                 .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
@@ -347,11 +459,23 @@ namespace OZZ::rendering::vk {
             if (vkAllocateCommandBuffers(device, &allocInfo, &tracyCmdBuf) == VK_SUCCESS) {
                 tracyGpuContext = OZZ_GPU_CONTEXT_CREATE(physicalDevices.SelectedDevice().Device,
                                                        device,
-                                                       graphicsQueue,
+                                                       graphicsQueue.Queue,
                                                        tracyCmdBuf);
                 OZZ_GPU_CONTEXT_NAME(tracyGpuContext, "Graphics", 8);
                 vkFreeCommandBuffers(device, commandBufferPool, 1, &tracyCmdBuf);
             }
+
+            // Timestamps are per queue, so the compute queue gets its own context
+            allocInfo.commandPool = computeQueue.TransientPool;
+            if (computeQueue.Queue != VK_NULL_HANDLE &&
+                vkAllocateCommandBuffers(device, &allocInfo, &tracyCmdBuf) == VK_SUCCESS) {
+                tracyComputeContext = OZZ_GPU_CONTEXT_CREATE(physicalDevices.SelectedDevice().Device,
+                                                           device,
+                                                           computeQueue.Queue,
+                                                           tracyCmdBuf);
+                OZZ_GPU_CONTEXT_NAME(tracyComputeContext, "Compute", 7);
+                vkFreeCommandBuffers(device, computeQueue.TransientPool, 1, &tracyCmdBuf);
+            }
         }
 
 #ifdef OZZ_SLANG_ENABLED
@@ -452,13 +576,26 @@ namespace OZZ::rendering::vk {
         OZZ_PROFILE_FUNCTION;
         float queuePriorities[] = {1.f};
 
-        VkDeviceQueueCreateInfo queueCreateInfo {
-            .sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
-            .flags = 0,
-            .queueFamilyIndex = physicalDevices.SelectedQueueFamily(),
-            .queueCount = 1,
-            .pQueuePriorities = queuePriorities,
+        std::vector<VkDeviceQueueCreateInfo> queueCreateInfos {
+            {
+                .sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
+                .flags = 0,
+                .queueFamilyIndex = graphicsQueue.Family,
+                .queueCount = 1,
+                .pQueuePriorities = queuePriorities,
+            },
         };
+        for (const auto* queue : {&transferQueue, &computeQueue}) {
+            if (queue->Family != UINT32_MAX) {
+                queueCreateInfos.push_back({
+                    .sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
+                    .flags = 0,
+                    .queueFamilyIndex = queue->Family,
+                    .queueCount = 1,
+                    .pQueuePriorities = queuePriorities,
+                });
+            }
+        }
 
         std::vector<const char*> deviceExtensions {
             VK_KHR_SWAPCHAIN_EXTENSION_NAME,
@@ -472,9 +609,85 @@ namespace OZZ::rendering::vk {
             exit(1);
         }
 
+        const auto& supportedFeatures = physicalDevices.SelectedDevice().Features.features;
+        bMultiDrawIndirect = supportedFeatures.multiDrawIndirect == VK_TRUE;
+        bDrawIndirectCount = physicalDevices.SelectedDevice().Features12.drawIndirectCount == VK_TRUE;
+
+        const auto& supportedFeatures12 = physicalDevices.SelectedDevice().Features12;
+        if (bBindless) {
+            bBindless = supportedFeatures12.descriptorIndexing && supportedFeatures12.runtimeDescriptorArray &&
+                        supportedFeatures12.descriptorBindingPartiallyBound &&
+                        supportedFeatures12.descriptorBindingSampledImageUpdateAfterBind &&
+                        supportedFeatures12.descriptorBindingStorageBufferUpdateAfterBind &&
+                        supportedFeatures12.descriptorBindingUpdateUnusedWhilePending &&
+                        supportedFeatures12.shaderSampledImageArrayNonUniformIndexing &&
+                        supportedFeatures12.shaderStorageBufferArrayNonUniformIndexing;
+            if (!bBindless) {
+                spdlog::warn("Bindless requested, but the device lacks the descriptor indexing features it needs");
+            }
+        }
+        if (bBindless) {
+            // Every shader stage may see the whole set, so the per-stage limits bound it too
+            const auto& properties12 = physicalDevices.SelectedDevice().Properties12;
+            const uint32_t textureLimit =
+                std::min({properties12.maxDescriptorSetUpdateAfterBindSampledImages,
+                          properties12.maxDescriptorSetUpdateAfterBindSamplers,
+                          properties12.maxPerStageDescriptorUpdateAfterBindSampledImages,
+                          properties12.maxPerStageDescriptorUpdateAfterBindSamplers});
+            const uint32_t bufferLimit = std::min(properties12.maxDescriptorSetUpdateAfterBindStorageBuffers,
+                                                  properties12.maxPerStageDescriptorUpdateAfterBindStorageBuffers);
+            if (maxBindlessTextures > textureLimit || maxBindlessBuffers > bufferLimit) {
+                spdlog::warn("Bindless capacity clamped to {} textures and {} buffers",
+                             std::min(maxBindlessTextures, textureLimit),
+                             std::min(maxBindlessBuffers, bufferLimit));
+            }
+            maxBindlessTextures = std::min(maxBindlessTextures, textureLimit);
+            maxBindlessBuffers = std::min(maxBindlessBuffers, bufferLimit);
+        }
+        const VkBool32 bindless = bBindless ? VK_TRUE : VK_FALSE;
+
+        if (bDescriptorBuffer) {
+            bDescriptorBuffer =
+                physicalDevices.SelectedDevice().SupportsExtension(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME) &&
+                physicalDevices.SelectedDevice().DescriptorBufferFeatures.descriptorBuffer &&
+                supportedFeatures12.bufferDeviceAddress;
+            if (bDescriptorBuffer) {
+                deviceExtensions.push_back(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+            } else {
+                spdlog::trace("Device lacks VK_EXT_descriptor_buffer; descriptor sets come from descriptor pools");
+            }
+        }
+
+        // Vulkan 1.2 features go through the aggregate struct, which may not be chained together
+        // with the individual 1.2 feature structs
+        VkPhysicalDeviceVulkan12Features vulkan12Features {
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES,
+            .pNext = nullptr,
+            .drawIndirectCount = bDrawIndirectCount ? VK_TRUE : VK_FALSE,
+            .descriptorIndexing = bindless,
+            .shaderSampledImageArrayNonUniformIndexing = bindless,
+            .shaderStorageBufferArrayNonUniformIndexing = bindless,
+            .descriptorBindingSampledImageUpdateAfterBind = bindless,
+            .descriptorBindingStorageBufferUpdateAfterBind = bindless,
+            .descriptorBindingUpdateUnusedWhilePending = bindless,
+            .descriptorBindingPartiallyBound = bindless,
+            .runtimeDescriptorArray = bindless,
+            .timelineSemaphore = VK_TRUE,
+            .bufferDeviceAddress = bDescriptorBuffer ? VK_TRUE : VK_FALSE,
+        };
+
+        VkPhysicalDeviceDescriptorBufferFeaturesEXT descriptorBufferFeatures {
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT,
+            .pNext = nullptr,
+            .descriptorBuffer = VK_TRUE,
+        };
+        if (bDescriptorBuffer) {
+            vulkan12Features.pNext = &descriptorBufferFeatures;
+        }
+
         VkPhysicalDeviceSynchronization2Features synchronization2Features {
             .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES,
-            .pNext = nullptr,
+            .pNext = &vulkan12Features,
             .synchronization2 = VK_TRUE,
         };
 
@@ -499,6 +712,8 @@ namespace OZZ::rendering::vk {
             .features =
                 VkPhysicalDeviceFeatures {
                     .geometryShader = VK_TRUE,
+                    .multiDrawIndirect = bMultiDrawIndirect ? VK_TRUE : VK_FALSE,
+                    .drawIndirectFirstInstance = supportedFeatures.drawIndirectFirstInstance,
                     .samplerAnisotropy = VK_TRUE,
                 },
         };
@@ -507,8 +722,8 @@ namespace OZZ::rendering::vk {
             .sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
             .pNext = &deviceFeatures,
             .flags = 0,
-            .queueCreateInfoCount = 1,
-            .pQueueCreateInfos = &queueCreateInfo,
+            .queueCreateInfoCount = static_cast<uint32_t>(queueCreateInfos.size()),
+            .pQueueCreateInfos = queueCreateInfos.data(),
             .enabledExtensionCount = static_cast<uint32_t>(deviceExtensions.size()),
             .ppEnabledExtensionNames = deviceExtensions.data(),
             .pEnabledFeatures = nullptr,
@@ -613,6 +828,9 @@ namespace OZZ::rendering::vk {
                 .Image = swapchainImages[i],
                 .ImageView = swapchainImageViews[i],
                 .Allocation = VK_NULL_HANDLE,
+                .Width = swapchainExtent.width,
+                .Height = swapchainExtent.height,
+                .Format = swapchainSurfaceFormat.format,
             };
             const auto handle = texturePool.Allocate(std::move(texture));
             if (!handle.IsValid()) {
@@ -636,16 +854,27 @@ namespace OZZ::rendering::vk {
                               static_cast<int>(result));
                 return false;
             }
+        }
 
-            // Create the depth images
-            swapchainDepthTextureHandles.emplace_back(CreateTexture({
+        return true;
+    }
+
+    bool RHIDeviceVulkan::createSwapchainDepthTextures() {
+        // Only the frames in flight record at once, so one depth buffer per frame slot is enough
+        // however many images the swapchain has. Frames never carry depth over, so it is transient.
+        for (auto i = 0U; i < framesInFlight; i++) {
+            const auto handle = CreateTexture({
                 .Width = swapchainExtent.width,
                 .Height = swapchainExtent.height,
                 .Format = TextureFormat::D24S8,
-                .Usage = TextureUsage::DepthAttachment,
-            }));
+                .Usage = TextureUsage::DepthAttachment | TextureUsage::Transient,
+            });
+            if (!handle.IsValid()) {
+                spdlog::error("Failed to create swapchain depth texture for frame {}", i);
+                return false;
+            }
+            swapchainDepthTextureHandles.push_back(handle);
         }
-
         return true;
     }
 
@@ -663,21 +892,77 @@ namespace OZZ::rendering::vk {
             return false;
         };
 
-        if (const auto result =
-                vkCreateCommandPool(device, &commandPoolCreateInfo, nullptr, &transientCommandBufferPool);
-            result != VK_SUCCESS) {
-            spdlog::error("Failed to create transient command buffer pool, error code: {}", static_cast<int>(result));
+        if (!createTransientCommandPool(graphicsQueue)) {
             return false;
         }
+        for (auto* queue : {&transferQueue, &computeQueue}) {
+            if (queue->Family != UINT32_MAX && !createTransientCommandPool(*queue)) {
+                return false;
+            }
+        }
 
         spdlog::trace("created command buffer pools");
         return true;
     }
 
+    bool RHIDeviceVulkan::createTransientCommandPool(DeviceQueue& queue) {
+        VkCommandPoolCreateInfo commandPoolCreateInfo {
+            .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT | VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,
+            .queueFamilyIndex = queue.Family,
+        };
+
+        if (const auto result = vkCreateCommandPool(device, &commandPoolCreateInfo, nullptr, &queue.TransientPool);
+            result != VK_SUCCESS) {
+            spdlog::error("Failed to create transient command buffer pool for queue family {}, error code: {}",
+                          queue.Family,
+                          static_cast<int>(result));
+            return false;
+        }
+        return true;
+    }
+
+    bool RHIDeviceVulkan::createTimelineSemaphore(DeviceQueue& queue) {
+        VkSemaphoreTypeCreateInfo semaphoreTypeCreateInfo {
+            .sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO,
+            .pNext = nullptr,
+            .semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE,
+            .initialValue = 0,
+        };
+
+        VkSemaphoreCreateInfo semaphoreCreateInfo {
+            .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+            .pNext = &semaphoreTypeCreateInfo,
+            .flags = 0,
+        };
+
+        if (const auto result = vkCreateSemaphore(device, &semaphoreCreateInfo, nullptr, &queue.Timeline);
+            result != VK_SUCCESS) {
+            spdlog::error("Failed to create timeline semaphore. Error: {}", static_cast<int>(result));
+            return false;
+        }
+
+        spdlog::trace("Timeline semaphore created (queue family {})", queue.Family);
+        return true;
+    }
+
     bool RHIDeviceVulkan::createSubmissionContexts() {
-        framesInFlight = std::min(MaxFramesInFlight, static_cast<uint32_t>(swapchainImages.size()));
+        const auto maxFrames = std::min(MaxFramesInFlight, static_cast<uint32_t>(swapchainImages.size()));
+        framesInFlight = std::clamp(requestedFramesInFlight, 1U, maxFrames);
+        if (framesInFlight != requestedFramesInFlight) {
+            spdlog::warn("Requested {} frames in flight, clamped to {} ({} swapchain images)",
+                         requestedFramesInFlight,
+                         framesInFlight,
+                         swapchainImages.size());
+        }
+        spdlog::trace("Frames in flight: {}", framesInFlight);
 
         submissionContexts.resize(framesInFlight);
+        {
+            std::lock_guard lock(deletionQueueMutex);
+            perFrameDeletions.resize(framesInFlight);
+        }
 
         std::vector<VkCommandBuffer> commandBuffers(framesInFlight);
         VkCommandBufferAllocateInfo commandBufferAllocateInfo {
@@ -711,62 +996,88 @@ namespace OZZ::rendering::vk {
                 return false;
             }
 
-            VkFenceCreateInfo fenceCreateInfo {
-                .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
-                .pNext = nullptr,
-                .flags = VK_FENCE_CREATE_SIGNALED_BIT,
-            };
-
-            if (const auto result =
-                    vkCreateFence(device, &fenceCreateInfo, nullptr, &submissionContexts[i].InFlightFence);
-                result != VK_SUCCESS) {
-                spdlog::error("Failed to create render fence for submission context {}, error code: {}",
-                              i,
-                              static_cast<int>(result));
-                return false;
-            }
-
-            auto handle = commandBufferResourcePool.Allocate(std::move(commandBuffers[i]));
+            auto handle = commandBufferResourcePool.Allocate(RHICommandBufferVulkan {
+                .CommandBuffer = commandBuffers[i],
+                .Pool = commandBufferPool,
+            });
             if (!handle.IsValid()) {
                 spdlog::error("Failed to allocate command buffer for submission context {}", i);
                 return false;
             }
             submissionContexts[i].CommandBuffer = handle;
+            submissionContexts[i].GraphicsCommandBuffers = {commandBuffers[i]};
         }
         return true;
     }
 
-    bool RHIDeviceVulkan::initializeQueue() {
-        vkGetDeviceQueue(device, physicalDevices.SelectedQueueFamily(), 0, &graphicsQueue);
-        return true;
-    }
+    bool RHIDeviceVulkan::createTransientBuffer() {
+        if (transientSliceSize == 0) {
+            return true;
+        }
 
-    bool RHIDeviceVulkan::createDescriptorPool() {
-        constexpr uint32_t PoolSize = 1000;
-        const VkDescriptorPoolSize poolSizes[] = {
-            {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, PoolSize},
-            {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, PoolSize},
-            {VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, PoolSize},
-            {VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, PoolSize},
-            {VK_DESCRIPTOR_TYPE_SAMPLER, PoolSize},
-            {VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, PoolSize},
+        constexpr auto TransientUsage = BufferUsage::VertexBuffer | BufferUsage::IndexBuffer |
+                                        BufferUsage::UniformBuffer | BufferUsage::StorageBuffer |
+                                        BufferUsage::Indirect;
+        const VkBufferCreateInfo bufferCreateInfo {
+            .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .size = transientSliceSize * framesInFlight,
+            // Slices may back uniform and storage descriptors, which descriptor buffers address
+            .usage = ConvertBufferUsageToVulkan(TransientUsage) |
+                     (bDescriptorBuffer ? VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT : VkBufferUsageFlags {0}),
+            .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+            .queueFamilyIndexCount = 0,
+            .pQueueFamilyIndices = nullptr,
         };
-
-        const VkDescriptorPoolCreateInfo poolCreateInfo {
-            .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
-            .flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT,
-            .maxSets = PoolSize,
-            .poolSizeCount = static_cast<uint32_t>(std::size(poolSizes)),
-            .pPoolSizes = poolSizes,
+        // Coherent, so writes through the mapped pointers need no flush before submission
+        const VmaAllocationCreateInfo allocationCreateInfo {
+            .flags = VMA_ALLOCATION_CREATE_MAPPED_BIT,
+            .usage = ConvertMemoryAccessToVulkan(BufferMemoryAccess::CpuToGpu),
+            .requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+            .preferredFlags = 0,
+            .memoryTypeBits = 0,
+            .pool = VK_NULL_HANDLE,
+            .pUserData = nullptr,
         };
 
-        if (const auto result = vkCreateDescriptorPool(device, &poolCreateInfo, nullptr, &descriptorPool);
+        RHIBufferVulkan buffer {
+            .Size = bufferCreateInfo.size,
+            .Usage = TransientUsage,
+            .Access = BufferMemoryAccess::CpuToGpu,
+            .Lifetime = BufferLifetime::Static,
+        };
+        if (const auto result = vmaCreateBuffer(vmaAllocator,
+                                                &bufferCreateInfo,
+                                                &allocationCreateInfo,
+                                                &buffer.Buffer,
+                                                &buffer.Allocation,
+                                                &buffer.AllocationInfo);
             result != VK_SUCCESS) {
-            spdlog::error("Failed to create descriptor pool. Error: {}", static_cast<int>(result));
+            spdlog::error("Failed to create transient buffer. Error: {}", static_cast<int>(result));
             return false;
         }
+        if (bDescriptorBuffer) {
+            const VkBufferDeviceAddressInfo addressInfo {
+                .sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO,
+                .pNext = nullptr,
+                .buffer = buffer.Buffer,
+            };
+            buffer.DeviceAddress = vkGetBufferDeviceAddress(device, &addressInfo);
+        }
 
-        spdlog::trace("Descriptor pool created");
+        transientBuffer = bufferResourcePool.Allocate({buffer});
+        spdlog::trace("Transient buffer created ({} bytes per frame)", transientSliceSize);
+        return true;
+    }
+
+    bool RHIDeviceVulkan::initializeQueue() {
+        vkGetDeviceQueue(device, graphicsQueue.Family, 0, &graphicsQueue.Queue);
+        for (auto* queue : {&transferQueue, &computeQueue}) {
+            if (queue->Family != UINT32_MAX) {
+                vkGetDeviceQueue(device, queue->Family, 0, &queue->Queue);
+            }
+        }
         return true;
     }
 
@@ -807,18 +1118,13 @@ namespace OZZ::rendering::vk {
             }
         }
 
-        // Wait only for in-flight frame fences rather than the entire device,
+        // Wait only for in-flight frame submissions rather than the entire device,
         // avoiding a stall on unrelated queues (e.g. transfer, compute).
-        std::vector<VkFence> fences;
-        fences.reserve(submissionContexts.size());
+        uint64_t lastFrameValue = 0;
         for (const auto& ctx : submissionContexts) {
-            if (ctx.InFlightFence != VK_NULL_HANDLE) {
-                fences.push_back(ctx.InFlightFence);
-            }
-        }
-        if (!fences.empty()) {
-            vkWaitForFences(device, static_cast<uint32_t>(fences.size()), fences.data(), VK_TRUE, UINT64_MAX);
+            lastFrameValue = std::max(lastFrameValue, ctx.TimelineValue);
         }
+        WaitForGpuValue(lastFrameValue, UINT64_MAX);
 
         if (!physicalDevices.RefreshSurfaceCapabilities(surface)) {
             spdlog::error("Failed to refresh surface capabilities during swapchain recreation");
@@ -842,6 +1148,10 @@ namespace OZZ::rendering::vk {
             vkDestroySwapchainKHR(device, oldSwapchain, nullptr);
         }
 
+        if (!createSwapchainDepthTextures()) {
+            return false;
+        }
+
         spdlog::info("Swapchain recreated ({}x{})", swapchainExtent.width, swapchainExtent.height);
         return true;
     }
@@ -850,17 +1160,17 @@ namespace OZZ::rendering::vk {
         return {swapchainExtent.width, swapchainExtent.height};
     }
 
-    VkCommandBuffer RHIDeviceVulkan::beginSingleTimeCommands() {
+    VkCommandBuffer RHIDeviceVulkan::beginSingleTimeCommands(DeviceQueue& queue) {
         VkCommandBufferAllocateInfo allocateInfo {
             .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
-            .commandPool = transientCommandBufferPool,
+            .commandPool = queue.TransientPool,
             .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
             .commandBufferCount = 1,
         };
 
         VkCommandBuffer commandBuffer;
         {
-            std::lock_guard lock(transientCmdPoolMutex);
+            std::lock_guard lock(queue.TransientPoolMutex);
             if (const auto result = vkAllocateCommandBuffers(device, &allocateInfo, &commandBuffer);
                 result != VK_SUCCESS) {
                 spdlog::error("Failed to allocate command buffer for single time commands. Error: {}",
@@ -878,68 +1188,162 @@ namespace OZZ::rendering::vk {
         if (const auto result = vkBeginCommandBuffer(commandBuffer, &beginInfo); result != VK_SUCCESS) {
             spdlog::error("Failed to begin command buffer for single time commands. Error: {}",
                           static_cast<int>(result));
-            std::lock_guard lock(transientCmdPoolMutex);
-            vkFreeCommandBuffers(device, transientCommandBufferPool, 1, &commandBuffer);
+            std::lock_guard lock(queue.TransientPoolMutex);
+            vkFreeCommandBuffers(device, queue.TransientPool, 1, &commandBuffer);
             return VK_NULL_HANDLE;
         }
 
         {
-            std::lock_guard lock(transientCmdPoolMutex);
-            transientCommandBuffers.insert(commandBuffer);
+            std::lock_guard lock(queue.TransientPoolMutex);
+            queue.TransientBuffers.insert(commandBuffer);
         }
         return commandBuffer;
     }
 
-    void RHIDeviceVulkan::endSingleTimeCommands(VkCommandBuffer commandBuffer) {
-        const auto cleanCommandBuffer = [this](VkCommandBuffer cmdBuffer) {
-            const auto commandBufferCopy = cmdBuffer;
-            std::lock_guard lock(transientCmdPoolMutex);
-            vkFreeCommandBuffers(device, transientCommandBufferPool, 1, &cmdBuffer);
-            transientCommandBuffers.erase(commandBufferCopy);
-        };
-
+    void RHIDeviceVulkan::endSingleTimeCommands(DeviceQueue& queue, VkCommandBuffer commandBuffer) {
         if (const auto result = vkEndCommandBuffer(commandBuffer); result != VK_SUCCESS) {
             spdlog::error("Failed to end command buffer for single time commands. Error: {}", static_cast<int>(result));
-            cleanCommandBuffer(commandBuffer);
+            freeSingleTimeCommands(queue, commandBuffer);
             return;
         }
 
-        VkSubmitInfo submitInfo {
-            .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
-            .commandBufferCount = 1,
-            .pCommandBuffers = &commandBuffer,
+        const auto signaledValue = submitCommandBuffer(queue, commandBuffer);
+        if (signaledValue == 0) {
+            spdlog::error("Failed to submit command buffer for single time commands");
+            freeSingleTimeCommands(queue, commandBuffer);
+            return;
+        }
+
+        waitForQueueValue(queue, signaledValue, UINT64_MAX);
+        freeSingleTimeCommands(queue, commandBuffer);
+    }
+
+    void RHIDeviceVulkan::freeSingleTimeCommands(DeviceQueue& queue, VkCommandBuffer commandBuffer) {
+        std::lock_guard lock(queue.TransientPoolMutex);
+        vkFreeCommandBuffers(device, queue.TransientPool, 1, &commandBuffer);
+        queue.TransientBuffers.erase(commandBuffer);
+    }
+
+    DeviceQueue& RHIDeviceVulkan::uploadQueue() {
+        return transferQueue.Queue != VK_NULL_HANDLE ? transferQueue : graphicsQueue;
+    }
+
+    DeviceQueue& RHIDeviceVulkan::asyncComputeQueue() {
+        return computeQueue.Queue != VK_NULL_HANDLE ? computeQueue : graphicsQueue;
+    }
+
+    const DeviceQueue& RHIDeviceVulkan::asyncComputeQueue() const {
+        return computeQueue.Queue != VK_NULL_HANDLE ? computeQueue : graphicsQueue;
+    }
+
+    DeviceQueue& RHIDeviceVulkan::queueFor(QueueType queue) {
+        return queue == QueueType::Compute ? asyncComputeQueue() : graphicsQueue;
+    }
+
+    TracyVkCtx RHIDeviceVulkan::profilingContext(const RHICommandBufferVulkan& commandBuffer) const {
+        return commandBuffer.bAsyncCompute && tracyComputeContext ? tracyComputeContext : tracyGpuContext;
+    }
+
+    uint64_t RHIDeviceVulkan::submitCommandBuffer(DeviceQueue& queue,
+                                                  VkCommandBuffer cmd,
+                                                  std::span<const VkSemaphoreSubmitInfo> waitSemaphores,
+                                                  std::span<const VkSemaphoreSubmitInfo> signalSemaphores) {
+        const VkCommandBufferSubmitInfo commandBufferInfo {
+            .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO,
+            .pNext = nullptr,
+            .commandBuffer = cmd,
+            .deviceMask = 0,
         };
 
-        // create a fence
-        VkFenceCreateInfo fenceCreateInfo {
-            .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
+        std::vector<VkSemaphoreSubmitInfo> signals(signalSemaphores.begin(), signalSemaphores.end());
+        signals.push_back({
+            .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+            .pNext = nullptr,
+            .semaphore = queue.Timeline,
+            .value = 0, // assigned under the queue lock below
+            .stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+            .deviceIndex = 0,
+        });
+
+        const VkSubmitInfo2 submitInfo {
+            .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
             .pNext = nullptr,
             .flags = 0,
+            .waitSemaphoreInfoCount = static_cast<uint32_t>(waitSemaphores.size()),
+            .pWaitSemaphoreInfos = waitSemaphores.data(),
+            .commandBufferInfoCount = 1,
+            .pCommandBufferInfos = &commandBufferInfo,
+            .signalSemaphoreInfoCount = static_cast<uint32_t>(signals.size()),
+            .pSignalSemaphoreInfos = signals.data(),
         };
 
-        VkFence submitFence {VK_NULL_HANDLE};
-        if (const auto result = vkCreateFence(device, &fenceCreateInfo, nullptr, &submitFence); result != VK_SUCCESS) {
-            spdlog::error("Failed to create fence for single time command submission. Error: {}",
-                          static_cast<int>(result));
-            cleanCommandBuffer(commandBuffer);
-            return;
+        // Timeline signal values must increase in queue submission order, so the value is
+        // allocated and submitted under the same lock.
+        std::lock_guard lock(queue.SubmitMutex);
+        const uint64_t signalValue = queue.SubmittedValue.load() + 1;
+        signals.back().value = signalValue;
+        if (const auto result = vkQueueSubmit2(queue.Queue, 1, &submitInfo, VK_NULL_HANDLE); result != VK_SUCCESS) {
+            spdlog::error("Failed to submit command buffer. Error: {}", static_cast<int>(result));
+            return 0;
         }
+        queue.SubmittedValue.store(signalValue);
+        return signalValue;
+    }
 
-        {
-            std::lock_guard lock(graphicsQueueMutex);
-            if (const auto result = vkQueueSubmit(graphicsQueue, 1, &submitInfo, submitFence); result != VK_SUCCESS) {
-                spdlog::error("Failed to submit command buffer for single time commands. Error: {}",
-                              static_cast<int>(result));
-                vkDestroyFence(device, submitFence, nullptr);
-                cleanCommandBuffer(commandBuffer);
-                return;
-            }
+    bool RHIDeviceVulkan::waitForQueueValue(DeviceQueue& queue, const uint64_t value, const uint64_t timeoutNs) {
+        if (value == 0) {
+            return true;
+        }
+        // A timeline wait on a value nothing will ever signal would never return.
+        if (value > queue.SubmittedValue.load()) {
+            spdlog::error("Timeline value {} has not been submitted on queue family {} (last submitted {})",
+                          value,
+                          queue.Family,
+                          queue.SubmittedValue.load());
+            return false;
         }
 
-        vkWaitForFences(device, 1, &submitFence, VK_TRUE, UINT64_MAX);
-        vkDestroyFence(device, submitFence, nullptr);
+        const VkSemaphoreWaitInfo waitInfo {
+            .sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .semaphoreCount = 1,
+            .pSemaphores = &queue.Timeline,
+            .pValues = &value,
+        };
+
+        const auto result = vkWaitSemaphores(device, &waitInfo, timeoutNs);
+        if (result == VK_TIMEOUT) {
+            return false;
+        }
+        if (result != VK_SUCCESS) {
+            spdlog::error("Failed to wait for timeline value {}. Error: {}", value, static_cast<int>(result));
+            return false;
+        }
+        return true;
+    }
+
+    // ============================================================
+    // === GPU Progress ===
+    // ============================================================
+
+    uint64_t RHIDeviceVulkan::GetSubmittedGpuValue() const {
+        return graphicsQueue.SubmittedValue.load();
+    }
+
+    uint64_t RHIDeviceVulkan::GetCompletedGpuValue() const {
+        uint64_t value = 0;
+        if (const auto result = vkGetSemaphoreCounterValue(device, graphicsQueue.Timeline, &value);
+            result != VK_SUCCESS) {
+            spdlog::error("Failed to query timeline semaphore value. Error: {}", static_cast<int>(result));
+            return 0;
+        }
+        return value;
+    }
 
-        cleanCommandBuffer(commandBuffer);
+    bool RHIDeviceVulkan::WaitForGpuValue(const uint64_t value, const uint64_t timeoutNs) {
+        OZZ_PROFILE_FUNCTION;
+        return waitForQueueValue(graphicsQueue, value, timeoutNs);
     }
 
     // ============================================================
@@ -948,10 +1352,10 @@ namespace OZZ::rendering::vk {
 
     RHIFrameContext RHIDeviceVulkan::BeginFrame() {
         OZZ_PROFILE_FUNCTION;
-        const auto& submissionContext = submissionContexts[currentFrame];
-        if (const auto fenceResult = vkWaitForFences(device, 1, &submissionContext.InFlightFence, VK_TRUE, UINT64_MAX);
-            fenceResult != VK_SUCCESS) {
-            spdlog::error("Failed to wait for fence in BeginFrame. Error: {}", static_cast<int>(fenceResult));
+        auto& submissionContext = submissionContexts[currentFrame];
+        if (!WaitForGpuValue(submissionContext.TimelineValue, UINT64_MAX) ||
+            !waitForQueueValue(asyncComputeQueue(), submissionContext.ComputeTimelineValue, UINT64_MAX)) {
+            spdlog::error("Failed to wait for frame slot {} in BeginFrame", currentFrame);
             return RHIFrameContext::Null();
         }
 
@@ -967,6 +1371,32 @@ namespace OZZ::rendering::vk {
             deletionFunc();
         }
 
+        {
+            std::lock_guard lock(uploadMutex);
+            retireUploadBatchesLocked();
+        }
+
+        // Recycle the secondaries forked and the async compute buffers recorded during this
+        // slot's previous frame
+        for (auto& framePool : submissionContext.ParallelPools) {
+            if (framePool.Pool != VK_NULL_HANDLE) {
+                vkResetCommandPool(device, framePool.Pool, 0);
+            }
+            framePool.NextFree = 0;
+        }
+        if (submissionContext.ComputePool.Pool != VK_NULL_HANDLE) {
+            vkResetCommandPool(device, submissionContext.ComputePool.Pool, 0);
+        }
+        submissionContext.ComputePool.NextFree = 0;
+
+        {
+            std::lock_guard lock(transientMutex);
+            submissionContext.TransientHead = 0;
+            descriptorSetResourcePool.Free(submissionContext.TransientDescriptorSets);
+            submissionContext.TransientDescriptorSets.clear();
+            submissionContext.TransientDescriptors.Reset(device);
+        }
+
         uint32_t imageIndex;
         VkResult acquireResult = vkAcquireNextImageKHR(device,
                                                        swapchain,
@@ -976,8 +1406,8 @@ namespace OZZ::rendering::vk {
                                                        &imageIndex);
 
         if (acquireResult == VK_ERROR_OUT_OF_DATE_KHR) {
-            // Fence is still signaled (we haven't reset it yet), so the next BeginFrame
-            // will not deadlock waiting on it.
+            // The slot's timeline value only advances on submit, so bailing out here
+            // cannot leave the next BeginFrame waiting on work that was never submitted.
             if (!recreateSwapchain()) {
                 return RHIFrameContext::Null();
             }
@@ -992,14 +1422,22 @@ namespace OZZ::rendering::vk {
 
         if (acquireResult != VK_SUCCESS && acquireResult != VK_SUBOPTIMAL_KHR) {
             spdlog::error("Failed to acquire next image in BeginFrame. Error: {}", static_cast<int>(acquireResult));
-            // Fence is still signaled — no deadlock on the next frame.
             return RHIFrameContext::Null();
         }
 
-        // Commit to this frame: reset the fence only now that we will submit work.
-        vkResetFences(device, 1, &submissionContext.InFlightFence);
-
-        const auto commandBuffer = commandBufferResourcePool.Get(submissionContext.CommandBuffer);
+        auto* commandBuffer = commandBufferResourcePool.Get(submissionContext.CommandBuffer);
+        commandBuffer->CommandBuffer = submissionContext.GraphicsCommandBuffers[0];
+        commandBuffer->bStateSetThisPass = false;
+        commandBuffer->bRecordedStateValid = false;
+        commandBuffer->DescriptorBuffersBound = 0;
+        commandBuffer->BoundBufferSets.clear();
+        commandBuffer->bInRenderPass = false;
+        commandBuffer->bParallelRenderPass = false;
+        commandBuffer->PendingWaits.clear();
+        commandBuffer->PendingImageBarriers.clear();
+        commandBuffer->PendingBufferBarriers.clear();
+        submissionContext.NextGraphicsCommandBuffer = 1;
+        submissionContext.bAcquireWaitPending = true;
 
         VkCommandBufferBeginInfo VkCommandBufferBeginInfo {
             .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
@@ -1008,14 +1446,15 @@ namespace OZZ::rendering::vk {
             .pInheritanceInfo = nullptr,
         };
 
-        if (const auto result = vkBeginCommandBuffer(*commandBuffer, &VkCommandBufferBeginInfo); result != VK_SUCCESS) {
+        if (const auto result = vkBeginCommandBuffer(commandBuffer->CommandBuffer, &VkCommandBufferBeginInfo);
+            result != VK_SUCCESS) {
             spdlog::error("Failed to begin command buffer in BeginFrame. Error: {}", static_cast<int>(result));
             return RHIFrameContext::Null();
         }
 
         auto frameContext = BuildFrameContext(submissionContext.CommandBuffer,
                                               swapchainTextureHandles[imageIndex],
-                                              swapchainDepthTextureHandles[imageIndex],
+                                              swapchainDepthTextureHandles[currentFrame],
                                               imageIndex,
                                               currentFrame);
         TextureResourceBarrier(frameContext,
@@ -1029,57 +1468,44 @@ namespace OZZ::rendering::vk {
                                    .DstAccess = Access::ColorAttachmentWrite,
                                });
 
+        recordingFrame.store(static_cast<uint32_t>(currentFrame), std::memory_order_release);
         return std::move(frameContext);
     }
 
     void RHIDeviceVulkan::SubmitAndPresentFrame(RHIFrameContext&& frameContext) {
         OZZ_PROFILE_FUNCTION;
+        // The GPU may read this slot's Stream copies from here on
+        recordingFrame.store(NoRecordingFrame, std::memory_order_release);
         // Prepare swapchain image for presentation
         const auto imageIndex = GetImageIndexFromFrameContext(frameContext);
 
-        TextureResourceBarrier(frameContext,
-                               TextureBarrierDescriptor {
-                                   .Texture = swapchainTextureHandles[imageIndex],
-                                   .OldLayout = TextureLayout::ColorAttachment,
-                                   .NewLayout = TextureLayout::Present,
-                                   .SrcStage = PipelineStage::ColorAttachmentOutput,
-                                   .DstStage = PipelineStage::None,
-                                   .SrcAccess = Access::ColorAttachmentWrite,
-                                   .DstAccess = Access::None,
-                               });
+        // From whatever the frame left the backbuffer in, normally ColorAttachment
+        transitionTextureInternal(*commandBufferResourcePool.Get(frameContext.GetCommandBuffer()),
+                                  swapchainTextureHandles[imageIndex],
+                                  TextureState::Present,
+                                  {});
 
-        auto commandBuffer = commandBufferResourcePool.Get(frameContext.GetCommandBuffer());
-        OZZ_GPU_COLLECT(tracyGpuContext, *commandBuffer);
-        if (const auto result = vkEndCommandBuffer(*commandBuffer); result != VK_SUCCESS) {
-            spdlog::error("Failed to end command buffer in SubmitFrame. Error: {}", static_cast<int>(result));
-            return;
-        }
+        auto* commandBuffer = commandBufferResourcePool.Get(frameContext.GetCommandBuffer());
+        OZZ_GPU_COLLECT(tracyGpuContext, commandBuffer->CommandBuffer);
 
         const auto frameNumber = GetFrameNumberFromFrameContext(frameContext);
         auto& submissionContext = submissionContexts[frameNumber];
-        VkPipelineStageFlags waitFlags {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT};
-        VkSubmitInfo submitInfo {
-            .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+        const VkSemaphoreSubmitInfo signalInfo {
+            .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
             .pNext = nullptr,
-            .waitSemaphoreCount = 1,
-            .pWaitSemaphores = &submissionContext.AcquireImageSemaphore,
-            .pWaitDstStageMask = &waitFlags,
-            .commandBufferCount = 1,
-            .pCommandBuffers = commandBuffer,
-            .signalSemaphoreCount = 1,
-            .pSignalSemaphores = &presentCompleteSemaphores[imageIndex],
+            .semaphore = presentCompleteSemaphores[imageIndex],
+            .value = 0,
+            .stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+            .deviceIndex = 0,
         };
 
-        {
-            std::lock_guard lock(graphicsQueueMutex);
-            if (const auto result = vkQueueSubmit(graphicsQueue, 1, &submitInfo, submissionContext.InFlightFence)) {
-                spdlog::error("Failed to submit command buffer in SubmitFrame. Error: {} | {} / {} | {:x}",
-                              static_cast<int>(result),
-                              imageIndex,
-                              frameNumber,
-                              reinterpret_cast<uint64_t>(presentCompleteSemaphores[imageIndex]));
-                return;
-            }
+        const auto signaledValue = submitFrameCommandBuffer(submissionContext, *commandBuffer, {&signalInfo, 1});
+        if (signaledValue == 0) {
+            spdlog::error("Failed to submit command buffer in SubmitFrame. {} / {} | {:x}",
+                          imageIndex,
+                          frameNumber,
+                          reinterpret_cast<uint64_t>(presentCompleteSemaphores[imageIndex]));
+            return;
         }
 
         VkPresentInfoKHR presentInfo {
@@ -1095,8 +1521,8 @@ namespace OZZ::rendering::vk {
 
         bool bNeedsRecreate = false;
         {
-            std::lock_guard lock(graphicsQueueMutex);
-            if (const auto result = vkQueuePresentKHR(graphicsQueue, &presentInfo);
+            std::lock_guard lock(graphicsQueue.SubmitMutex);
+            if (const auto result = vkQueuePresentKHR(graphicsQueue.Queue, &presentInfo);
                 result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR) {
                 bNeedsRecreate = true;
             } else if (result != VK_SUCCESS) {
@@ -1110,37 +1536,448 @@ namespace OZZ::rendering::vk {
         currentFrame = (currentFrame + 1) % framesInFlight;
     }
 
+    uint64_t RHIDeviceVulkan::submitFrameCommandBuffer(SubmissionContext& submissionContext,
+                                                       RHICommandBufferVulkan& commandBuffer,
+                                                       std::span<const VkSemaphoreSubmitInfo> signalSemaphores) {
+        // Uploads recorded so far go ahead of every frame submission, FlushGraphics included, so
+        // the work may sample what they wrote
+        SubmitUploads();
+
+        flushPendingBarriers(commandBuffer);
+        if (const auto result = vkEndCommandBuffer(commandBuffer.CommandBuffer); result != VK_SUCCESS) {
+            spdlog::error("Failed to end frame command buffer. Error: {}", static_cast<int>(result));
+            return 0;
+        }
+
+        std::vector<VkSemaphoreSubmitInfo> waits = std::move(commandBuffer.PendingWaits);
+        commandBuffer.PendingWaits.clear();
+        // Only the first submission waits for the swapchain image. The backbuffer transition
+        // recorded in BeginFrame chains off this wait, and later submissions are ordered after
+        // that transition by its barrier.
+        if (submissionContext.bAcquireWaitPending) {
+            waits.push_back({
+                .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+                .pNext = nullptr,
+                .semaphore = submissionContext.AcquireImageSemaphore,
+                .value = 0,
+                .stageMask = VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT,
+                .deviceIndex = 0,
+            });
+        }
+
+        const auto signaledValue = submitCommandBuffer(graphicsQueue, commandBuffer.CommandBuffer, waits, signalSemaphores);
+        if (signaledValue != 0) {
+            submissionContext.bAcquireWaitPending = false;
+            submissionContext.TimelineValue = signaledValue;
+        }
+        return signaledValue;
+    }
+
     // ============================================================
-    // === Command Buffer Recording - Render Pass ===
+    // === Parallel Recording ===
     // ============================================================
 
-    void RHIDeviceVulkan::BeginRenderPass(const RHIFrameContext& frameContext,
-                                          const RenderPassDescriptor& renderPassDescriptor) {
+    std::vector<RHIFrameContext> RHIDeviceVulkan::ForkRecordingContexts(const RHIFrameContext& frameContext,
+                                                                        uint32_t count) {
         OZZ_PROFILE_FUNCTION;
-        beginRenderPassInternal(*commandBufferResourcePool.Get(frameContext.GetCommandBuffer()), renderPassDescriptor);
-    }
+        std::vector<RHIFrameContext> recordingContexts;
+        const auto* primary = commandBufferResourcePool.Get(frameContext.GetCommandBuffer());
+        if (!primary) {
+            spdlog::error("Invalid frame context passed to ForkRecordingContexts");
+            return recordingContexts;
+        }
+        if (primary->bIsSecondary || primary->bAsyncCompute) {
+            spdlog::error("ForkRecordingContexts called on a forked or async compute context; fork from the frame context");
+            return recordingContexts;
+        }
+        if (primary->bInRenderPass && !primary->bParallelRenderPass) {
+            spdlog::error("ForkRecordingContexts called inside a render pass not begun with ParallelRecording");
+            return recordingContexts;
+        }
 
-    void RHIDeviceVulkan::beginRenderPassInternal(VkCommandBuffer cmd,
-                                                  const RenderPassDescriptor& renderPassDescriptor) {
-        OZZ_GPU_ZONE(tracyGpuContext, cmd, "BeginRenderPass");
-        // Graphics state does not carry across render passes: callers must call
-        // SetGraphicsState after each BeginRenderPass, before any draw.
-        stateSetThisPass = false;
-        std::array<VkRenderingAttachmentInfo, MaxColorAttachments> colorAttachments;
-        uint32_t colorAttachmentCount = 0;
-        bool bHasDepthAttachment = false;
-        bool bHasStencilAttachment = false;
-        VkRenderingAttachmentInfo depthAttachment;
-        VkRenderingAttachmentInfo stencilAttachment;
+        const auto frameNumber = GetFrameNumberFromFrameContext(frameContext);
+        auto& submissionContext = submissionContexts[frameNumber];
+        if (submissionContext.ParallelPools.size() < count) {
+            submissionContext.ParallelPools.resize(count);
+        }
 
-        for (auto i = 0u; i < renderPassDescriptor.ColorAttachmentCount; i++) {
-            const auto& attachment = renderPassDescriptor.ColorAttachments[i];
-            if (attachment.Texture == RHITextureHandle::Null()) {
-                spdlog::error("Color attachment {} is null in BeginRenderPass", i);
+        // Inside a parallel pass the secondaries continue the primary's dynamic rendering
+        // instance and must declare the same attachment formats.
+        const VkCommandBufferInheritanceRenderingInfo renderingInheritanceInfo {
+            .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .viewMask = 0,
+            .colorAttachmentCount = primary->ColorFormatCount,
+            .pColorAttachmentFormats = primary->ColorFormats.data(),
+            .depthAttachmentFormat = primary->DepthFormat,
+            .stencilAttachmentFormat = primary->StencilFormat,
+            .rasterizationSamples = primary->Samples,
+        };
+
+        const VkCommandBufferInheritanceInfo inheritanceInfo {
+            .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
+            .pNext = primary->bInRenderPass ? &renderingInheritanceInfo : nullptr,
+            .renderPass = VK_NULL_HANDLE,
+            .subpass = 0,
+            .framebuffer = VK_NULL_HANDLE,
+            .occlusionQueryEnable = VK_FALSE,
+            .queryFlags = 0,
+            .pipelineStatistics = 0,
+        };
+
+        const VkCommandBufferBeginInfo beginInfo {
+            .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+            .pNext = nullptr,
+            .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT |
+                     (primary->bInRenderPass ? VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT
+                                             : VkCommandBufferUsageFlags {0}),
+            .pInheritanceInfo = &inheritanceInfo,
+        };
+
+        recordingContexts.reserve(count);
+        for (auto i = 0u; i < count; i++) {
+            const auto handle = acquireFrameCommandBuffer(submissionContext.ParallelPools[i],
+                                                          graphicsQueue.Family,
+                                                          VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+            if (!handle.IsValid()) {
+                break;
+            }
+
+            auto* secondary = commandBufferResourcePool.Get(handle);
+            secondary->bStateSetThisPass = false;
+            secondary->bRecordedStateValid = false;
+            secondary->DescriptorBuffersBound = 0;
+            secondary->BoundBufferSets.clear();
+            secondary->PendingImageBarriers.clear();
+            secondary->PendingBufferBarriers.clear();
+            secondary->bInRenderPass = primary->bInRenderPass;
+            secondary->bParallelRenderPass = false;
+            secondary->ColorFormats = primary->ColorFormats;
+            secondary->ColorFormatCount = primary->ColorFormatCount;
+            secondary->DepthFormat = primary->DepthFormat;
+            secondary->StencilFormat = primary->StencilFormat;
+
+            if (const auto result = vkBeginCommandBuffer(secondary->CommandBuffer, &beginInfo); result != VK_SUCCESS) {
+                spdlog::error("Failed to begin secondary command buffer {}. Error: {}", i, static_cast<int>(result));
+                break;
+            }
+
+            recordingContexts.push_back(BuildFrameContext(handle,
+                                                          frameContext.GetBackbufferImage(),
+                                                          frameContext.GetBackbufferDepthImage(),
+                                                          GetImageIndexFromFrameContext(frameContext),
+                                                          frameNumber));
+        }
+
+        return recordingContexts;
+    }
+
+    void RHIDeviceVulkan::JoinRecordingContexts(const RHIFrameContext& frameContext,
+                                                std::vector<RHIFrameContext>&& recordingContexts) {
+        OZZ_PROFILE_FUNCTION;
+        auto* primary = commandBufferResourcePool.Get(frameContext.GetCommandBuffer());
+        if (!primary) {
+            spdlog::error("Invalid frame context passed to JoinRecordingContexts");
+            return;
+        }
+
+        std::vector<VkCommandBuffer> secondaries;
+        secondaries.reserve(recordingContexts.size());
+        for (const auto& recordingContext : recordingContexts) {
+            auto* secondary = commandBufferResourcePool.Get(recordingContext.GetCommandBuffer());
+            if (!secondary || !secondary->bIsSecondary) {
+                spdlog::error("JoinRecordingContexts given a context that was not forked; skipping it");
+                continue;
+            }
+            flushPendingBarriers(*secondary);
+            if (const auto result = vkEndCommandBuffer(secondary->CommandBuffer); result != VK_SUCCESS) {
+                spdlog::error("Failed to end secondary command buffer. Error: {}", static_cast<int>(result));
+                continue;
+            }
+            secondaries.push_back(secondary->CommandBuffer);
+        }
+        recordingContexts.clear();
+
+        if (secondaries.empty()) {
+            return;
+        }
+
+        flushPendingBarriers(*primary);
+        OZZ_GPU_ZONE(tracyGpuContext, primary->CommandBuffer, "ExecuteCommands");
+        vkCmdExecuteCommands(primary->CommandBuffer, static_cast<uint32_t>(secondaries.size()), secondaries.data());
+        // Dynamic state on the primary is undefined after executing secondaries
+        primary->bStateSetThisPass = false;
+        primary->bRecordedStateValid = false;
+        primary->DescriptorBuffersBound = 0;
+        primary->BoundBufferSets.clear();
+    }
+
+    RHICommandBufferHandle RHIDeviceVulkan::acquireFrameCommandBuffer(FrameCommandPool& framePool,
+                                                                      uint32_t queueFamily,
+                                                                      VkCommandBufferLevel level) {
+        if (framePool.Pool == VK_NULL_HANDLE) {
+            // Buffers are only ever reset together with the pool, once per frame slot
+            const VkCommandPoolCreateInfo commandPoolCreateInfo {
+                .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+                .pNext = nullptr,
+                .flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,
+                .queueFamilyIndex = queueFamily,
+            };
+            if (const auto result = vkCreateCommandPool(device, &commandPoolCreateInfo, nullptr, &framePool.Pool);
+                result != VK_SUCCESS) {
+                spdlog::error("Failed to create frame command pool for queue family {}. Error: {}",
+                              queueFamily,
+                              static_cast<int>(result));
+                return RHICommandBufferHandle::Null();
+            }
+        }
+
+        if (framePool.NextFree < framePool.CommandBuffers.size()) {
+            return framePool.CommandBuffers[framePool.NextFree++];
+        }
+
+        const VkCommandBufferAllocateInfo allocateInfo {
+            .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+            .pNext = nullptr,
+            .commandPool = framePool.Pool,
+            .level = level,
+            .commandBufferCount = 1,
+        };
+        VkCommandBuffer commandBuffer {VK_NULL_HANDLE};
+        if (const auto result = vkAllocateCommandBuffers(device, &allocateInfo, &commandBuffer); result != VK_SUCCESS) {
+            spdlog::error("Failed to allocate frame command buffer. Error: {}", static_cast<int>(result));
+            return RHICommandBufferHandle::Null();
+        }
+
+        const auto handle = commandBufferResourcePool.Allocate(RHICommandBufferVulkan {
+            .CommandBuffer = commandBuffer,
+            .Pool = framePool.Pool,
+            .bIsSecondary = level == VK_COMMAND_BUFFER_LEVEL_SECONDARY,
+        });
+        framePool.CommandBuffers.push_back(handle);
+        framePool.NextFree++;
+        return handle;
+    }
+
+    // ============================================================
+    // === Async Compute ===
+    // ============================================================
+
+    RHIFrameContext RHIDeviceVulkan::BeginAsyncCompute(const RHIFrameContext& frameContext) {
+        OZZ_PROFILE_FUNCTION;
+        const auto* primary = commandBufferResourcePool.Get(frameContext.GetCommandBuffer());
+        if (!primary || primary->bIsSecondary || primary->bAsyncCompute) {
+            spdlog::error("BeginAsyncCompute expects the frame context");
+            return RHIFrameContext::Null();
+        }
+
+        const auto frameNumber = GetFrameNumberFromFrameContext(frameContext);
+        auto& submissionContext = submissionContexts[frameNumber];
+        const auto handle = acquireFrameCommandBuffer(submissionContext.ComputePool,
+                                                      asyncComputeQueue().Family,
+                                                      VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+        if (!handle.IsValid()) {
+            return RHIFrameContext::Null();
+        }
+
+        auto* commandBuffer = commandBufferResourcePool.Get(handle);
+        commandBuffer->bAsyncCompute = true;
+        commandBuffer->bStateSetThisPass = false;
+        commandBuffer->bRecordedStateValid = false;
+        commandBuffer->DescriptorBuffersBound = 0;
+        commandBuffer->BoundBufferSets.clear();
+        commandBuffer->PendingImageBarriers.clear();
+        commandBuffer->PendingBufferBarriers.clear();
+        commandBuffer->bInRenderPass = false;
+        commandBuffer->bParallelRenderPass = false;
+        commandBuffer->PendingWaits.clear();
+
+        const VkCommandBufferBeginInfo beginInfo {
+            .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+            .pNext = nullptr,
+            .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+            .pInheritanceInfo = nullptr,
+        };
+        if (const auto result = vkBeginCommandBuffer(commandBuffer->CommandBuffer, &beginInfo); result != VK_SUCCESS) {
+            spdlog::error("Failed to begin async compute command buffer. Error: {}", static_cast<int>(result));
+            return RHIFrameContext::Null();
+        }
+
+        return BuildFrameContext(handle,
+                                 frameContext.GetBackbufferImage(),
+                                 frameContext.GetBackbufferDepthImage(),
+                                 GetImageIndexFromFrameContext(frameContext),
+                                 frameNumber);
+    }
+
+    GpuSyncPoint RHIDeviceVulkan::SubmitAsyncCompute(RHIFrameContext&& computeContext) {
+        OZZ_PROFILE_FUNCTION;
+        auto* commandBuffer = commandBufferResourcePool.Get(computeContext.GetCommandBuffer());
+        if (!commandBuffer || !commandBuffer->bAsyncCompute) {
+            spdlog::error("SubmitAsyncCompute given a context that did not come from BeginAsyncCompute");
+            return {};
+        }
+
+        flushPendingBarriers(*commandBuffer);
+        if (tracyComputeContext) {
+            OZZ_GPU_COLLECT(tracyComputeContext, commandBuffer->CommandBuffer);
+        }
+        if (const auto result = vkEndCommandBuffer(commandBuffer->CommandBuffer); result != VK_SUCCESS) {
+            spdlog::error("Failed to end async compute command buffer. Error: {}", static_cast<int>(result));
+            return {};
+        }
+
+        const std::vector<VkSemaphoreSubmitInfo> waits = std::move(commandBuffer->PendingWaits);
+        commandBuffer->PendingWaits.clear();
+        const auto signaledValue = submitCommandBuffer(asyncComputeQueue(), commandBuffer->CommandBuffer, waits);
+        if (signaledValue == 0) {
+            spdlog::error("Failed to submit async compute command buffer");
+            return {};
+        }
+
+        submissionContexts[GetFrameNumberFromFrameContext(computeContext)].ComputeTimelineValue = signaledValue;
+        return {.Queue = QueueType::Compute, .Value = signaledValue};
+    }
+
+    GpuSyncPoint RHIDeviceVulkan::FlushGraphics(const RHIFrameContext& frameContext) {
+        OZZ_PROFILE_FUNCTION;
+        auto* commandBuffer = commandBufferResourcePool.Get(frameContext.GetCommandBuffer());
+        if (!commandBuffer || commandBuffer->bIsSecondary || commandBuffer->bAsyncCompute) {
+            spdlog::error("FlushGraphics expects the frame context");
+            return {};
+        }
+        if (commandBuffer->bInRenderPass) {
+            spdlog::error("FlushGraphics called inside a render pass; end the pass first");
+            return {};
+        }
+
+        auto& submissionContext = submissionContexts[GetFrameNumberFromFrameContext(frameContext)];
+        // Secure the primary recording continues on before submitting, so a failed allocation
+        // leaves the frame context recordable.
+        if (submissionContext.NextGraphicsCommandBuffer == submissionContext.GraphicsCommandBuffers.size()) {
+            const VkCommandBufferAllocateInfo allocateInfo {
+                .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+                .pNext = nullptr,
+                .commandPool = commandBufferPool,
+                .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+                .commandBufferCount = 1,
+            };
+            VkCommandBuffer nextCommandBuffer {VK_NULL_HANDLE};
+            if (const auto result = vkAllocateCommandBuffers(device, &allocateInfo, &nextCommandBuffer);
+                result != VK_SUCCESS) {
+                spdlog::error("Failed to allocate command buffer in FlushGraphics. Error: {}", static_cast<int>(result));
+                return {};
+            }
+            submissionContext.GraphicsCommandBuffers.push_back(nextCommandBuffer);
+        }
+
+        const auto signaledValue = submitFrameCommandBuffer(submissionContext, *commandBuffer);
+        if (signaledValue == 0) {
+            spdlog::error("Failed to submit command buffer in FlushGraphics");
+            return {};
+        }
+
+        commandBuffer->CommandBuffer =
+            submissionContext.GraphicsCommandBuffers[submissionContext.NextGraphicsCommandBuffer++];
+        commandBuffer->bRecordedStateValid = false;
+        commandBuffer->DescriptorBuffersBound = 0;
+        commandBuffer->BoundBufferSets.clear();
+        const VkCommandBufferBeginInfo beginInfo {
+            .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+            .pNext = nullptr,
+            .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+            .pInheritanceInfo = nullptr,
+        };
+        if (const auto result = vkBeginCommandBuffer(commandBuffer->CommandBuffer, &beginInfo); result != VK_SUCCESS) {
+            // The submission went through, but nothing more can be recorded into this frame; an
+            // invalid sync point tells the caller to stop rather than wait on what follows
+            spdlog::error("Failed to begin command buffer in FlushGraphics. Error: {}", static_cast<int>(result));
+            return {};
+        }
+
+        return {.Queue = QueueType::Graphics, .Value = signaledValue};
+    }
+
+    void RHIDeviceVulkan::AddQueueDependency(const RHIFrameContext& context,
+                                             const GpuSyncPoint& syncPoint,
+                                             PipelineStage waitStage) {
+        auto* commandBuffer = commandBufferResourcePool.Get(context.GetCommandBuffer());
+        if (!commandBuffer || commandBuffer->bIsSecondary) {
+            spdlog::error("AddQueueDependency needs a frame or async compute context");
+            return;
+        }
+        if (!syncPoint.IsValid()) {
+            return;
+        }
+
+        const auto& queue = queueFor(syncPoint.Queue);
+        // A queue waiting on a value nothing will ever signal would never make progress
+        if (syncPoint.Value > queue.SubmittedValue.load()) {
+            spdlog::error("AddQueueDependency on timeline value {} that has not been submitted (last submitted {})",
+                          syncPoint.Value,
+                          queue.SubmittedValue.load());
+            return;
+        }
+
+        commandBuffer->PendingWaits.push_back({
+            .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+            .pNext = nullptr,
+            .semaphore = queue.Timeline,
+            .value = syncPoint.Value,
+            .stageMask = ConvertPipelineStageToVulkan(waitStage),
+            .deviceIndex = 0,
+        });
+    }
+
+    uint32_t RHIDeviceVulkan::GetQueueFamily(QueueType queue) const {
+        return queue == QueueType::Compute ? asyncComputeQueue().Family : graphicsQueue.Family;
+    }
+
+    // ============================================================
+    // === Command Buffer Recording - Render Pass ===
+    // ============================================================
+
+    void RHIDeviceVulkan::BeginRenderPass(const RHIFrameContext& frameContext,
+                                          const RenderPassDescriptor& renderPassDescriptor) {
+        OZZ_PROFILE_FUNCTION;
+        beginRenderPassInternal(*commandBufferResourcePool.Get(frameContext.GetCommandBuffer()), renderPassDescriptor);
+    }
+
+    void RHIDeviceVulkan::beginRenderPassInternal(RHICommandBufferVulkan& commandBuffer,
+                                                  const RenderPassDescriptor& renderPassDescriptor) {
+        const VkCommandBuffer cmd = commandBuffer.CommandBuffer;
+        OZZ_GPU_ZONE(tracyGpuContext, cmd, "BeginRenderPass");
+        if (commandBuffer.bAsyncCompute) {
+            spdlog::error("BeginRenderPass recorded on an async compute context");
+            return;
+        }
+        // Graphics state does not carry across render passes: callers must call
+        // SetGraphicsState after each BeginRenderPass, before any draw.
+        commandBuffer.bStateSetThisPass = false;
+        commandBuffer.bInRenderPass = true;
+        commandBuffer.bParallelRenderPass = renderPassDescriptor.ParallelRecording;
+        commandBuffer.ColorFormatCount = 0;
+        commandBuffer.DepthFormat = VK_FORMAT_UNDEFINED;
+        commandBuffer.StencilFormat = VK_FORMAT_UNDEFINED;
+        commandBuffer.Samples = VK_SAMPLE_COUNT_1_BIT;
+        std::array<VkRenderingAttachmentInfo, MaxColorAttachments> colorAttachments;
+        uint32_t colorAttachmentCount = 0;
+        bool bHasDepthAttachment = false;
+        bool bHasStencilAttachment = false;
+        VkRenderingAttachmentInfo depthAttachment;
+        VkRenderingAttachmentInfo stencilAttachment;
+
+        for (auto i = 0u; i < renderPassDescriptor.ColorAttachmentCount; i++) {
+            const auto& attachment = renderPassDescriptor.ColorAttachments[i];
+            if (attachment.Texture == RHITextureHandle::Null()) {
+                spdlog::error("Color attachment {} is null in BeginRenderPass", i);
                 continue;
             }
             VkClearValue clearValue;
             const auto* texture = texturePool.Get(attachment.Texture);
+            commandBuffer.ColorFormats[commandBuffer.ColorFormatCount++] = texture->Format;
+            commandBuffer.Samples = texture->Samples;
             if (attachment.Layout == TextureLayout::ColorAttachment) {
                 clearValue.color = {
                     attachment.Clear.R,
@@ -1159,12 +1996,15 @@ namespace OZZ::rendering::vk {
                 .storeOp = ConvertStoreOpToVulkan(attachment.Store),
                 .clearValue = clearValue,
             };
+            applyResolveTarget(attachmentInfo, *texture, attachment, false);
             colorAttachments[colorAttachmentCount++] = attachmentInfo;
         }
 
         if (renderPassDescriptor.DepthAttachment.Texture != RHITextureHandle::Null()) {
             bHasDepthAttachment = true;
             const auto* texture = texturePool.Get(renderPassDescriptor.DepthAttachment.Texture);
+            commandBuffer.DepthFormat = texture->Format;
+            commandBuffer.Samples = texture->Samples;
             VkClearValue clearValue;
             clearValue.depthStencil.depth = renderPassDescriptor.DepthAttachment.Clear.Depth;
             depthAttachment = VkRenderingAttachmentInfo {
@@ -1176,11 +2016,13 @@ namespace OZZ::rendering::vk {
                 .storeOp = ConvertStoreOpToVulkan(renderPassDescriptor.DepthAttachment.Store),
                 .clearValue = clearValue,
             };
+            applyResolveTarget(depthAttachment, *texture, renderPassDescriptor.DepthAttachment, true);
         }
 
         if (renderPassDescriptor.StencilAttachment.Texture != RHITextureHandle::Null()) {
             bHasStencilAttachment = true;
             const auto* texture = texturePool.Get(renderPassDescriptor.StencilAttachment.Texture);
+            commandBuffer.StencilFormat = texture->Format;
             VkClearValue clearValue;
             clearValue.depthStencil.stencil = renderPassDescriptor.StencilAttachment.Clear.Stencil;
             stencilAttachment = VkRenderingAttachmentInfo {
@@ -1192,12 +2034,19 @@ namespace OZZ::rendering::vk {
                 .storeOp = ConvertStoreOpToVulkan(renderPassDescriptor.StencilAttachment.Store),
                 .clearValue = clearValue,
             };
+            applyResolveTarget(stencilAttachment, *texture, renderPassDescriptor.StencilAttachment, true);
+        }
+
+        // Mirror the depth-as-stencil fallback below so forked contexts inherit matching formats
+        if (!bHasStencilAttachment && bHasDepthAttachment && HasStencilComponent(commandBuffer.DepthFormat)) {
+            commandBuffer.StencilFormat = commandBuffer.DepthFormat;
         }
 
         VkRenderingInfo renderingInfo {
             .sType = VK_STRUCTURE_TYPE_RENDERING_INFO,
             .pNext = nullptr,
-            .flags = 0,
+            .flags = renderPassDescriptor.ParallelRecording ? VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT
+                                                            : VkRenderingFlags {0},
             .renderArea =
                 {
                     .offset =
@@ -1220,17 +2069,45 @@ namespace OZZ::rendering::vk {
                                                         : nullptr,
         };
 
+        // Layout transitions into the attachments have to land before the rendering instance
+        flushPendingBarriers(commandBuffer);
         vkCmdBeginRendering(cmd, &renderingInfo);
     }
 
+    void RHIDeviceVulkan::applyResolveTarget(VkRenderingAttachmentInfo& attachmentInfo,
+                                             const RHITextureVulkan& texture,
+                                             const AttachmentDescriptor& attachment,
+                                             const bool bDepthStencil) {
+        if (!attachment.ResolveTexture.IsValid()) {
+            return;
+        }
+        const auto* resolveTexture = texturePool.Get(attachment.ResolveTexture);
+        if (!resolveTexture) {
+            spdlog::error("BeginRenderPass: invalid resolve texture handle");
+            return;
+        }
+        if (texture.Samples == VK_SAMPLE_COUNT_1_BIT || resolveTexture->Samples != VK_SAMPLE_COUNT_1_BIT ||
+            resolveTexture->Format != texture.Format) {
+            spdlog::error("BeginRenderPass: resolve needs a multisampled attachment and a single-sample texture "
+                          "of the same format");
+            return;
+        }
+        attachmentInfo.resolveMode = ConvertResolveModeToVulkan(attachment.Resolve, bDepthStencil);
+        attachmentInfo.resolveImageView = resolveTexture->ImageView;
+        attachmentInfo.resolveImageLayout = attachmentInfo.imageLayout;
+    }
+
     void RHIDeviceVulkan::EndRenderPass(const RHIFrameContext& frameContext) {
         OZZ_PROFILE_FUNCTION;
         endRenderPassInternal(*commandBufferResourcePool.Get(frameContext.GetCommandBuffer()));
     }
 
-    void RHIDeviceVulkan::endRenderPassInternal(VkCommandBuffer cmd) {
+    void RHIDeviceVulkan::endRenderPassInternal(RHICommandBufferVulkan& commandBuffer) {
+        const VkCommandBuffer cmd = commandBuffer.CommandBuffer;
         OZZ_GPU_ZONE(tracyGpuContext, cmd, "EndRenderPass");
         vkCmdEndRendering(cmd);
+        commandBuffer.bInRenderPass = false;
+        commandBuffer.bParallelRenderPass = false;
     }
 
     // ============================================================
@@ -1239,13 +2116,277 @@ namespace OZZ::rendering::vk {
 
     void RHIDeviceVulkan::TextureResourceBarrier(const RHIFrameContext& frameContext,
                                                  const TextureBarrierDescriptor& barrierDescriptor) {
-        textureResourceBarrierInternal(*commandBufferResourcePool.Get(frameContext.GetCommandBuffer()),
-                                       barrierDescriptor);
+        pipelineBarriersInternal(*commandBufferResourcePool.Get(frameContext.GetCommandBuffer()),
+                                 GetFrameNumberFromFrameContext(frameContext),
+                                 {&barrierDescriptor, 1},
+                                 {});
+    }
+
+    void RHIDeviceVulkan::BufferMemoryBarrier(const RHIFrameContext& frameContext,
+                                              const BufferBarrierDescriptor& barrierDescriptor) {
+        pipelineBarriersInternal(*commandBufferResourcePool.Get(frameContext.GetCommandBuffer()),
+                                 GetFrameNumberFromFrameContext(frameContext),
+                                 {},
+                                 {&barrierDescriptor, 1});
+    }
+
+    void RHIDeviceVulkan::PipelineBarriers(const RHIFrameContext& frameContext,
+                                           std::span<const TextureBarrierDescriptor> textureBarriers,
+                                           std::span<const BufferBarrierDescriptor> bufferBarriers) {
+        OZZ_PROFILE_FUNCTION;
+        pipelineBarriersInternal(*commandBufferResourcePool.Get(frameContext.GetCommandBuffer()),
+                                 GetFrameNumberFromFrameContext(frameContext),
+                                 textureBarriers,
+                                 bufferBarriers);
+    }
+
+    void RHIDeviceVulkan::pipelineBarriersInternal(RHICommandBufferVulkan& commandBuffer,
+                                                   uint32_t frameIndex,
+                                                   std::span<const TextureBarrierDescriptor> textureBarriers,
+                                                   std::span<const BufferBarrierDescriptor> bufferBarriers) {
+        for (const auto& barrierDescriptor : textureBarriers) {
+            if (const auto barrier = convertTextureBarrier(barrierDescriptor)) {
+                trackTextureBarrier(*barrier, barrierDescriptor.Texture);
+                commandBuffer.PendingImageBarriers.push_back(*barrier);
+            }
+        }
+        for (const auto& barrierDescriptor : bufferBarriers) {
+            if (const auto barrier = convertBufferBarrier(barrierDescriptor, frameIndex)) {
+                commandBuffer.PendingBufferBarriers.push_back(*barrier);
+            }
+        }
+    }
+
+    void RHIDeviceVulkan::flushPendingBarriers(RHICommandBufferVulkan& commandBuffer) {
+        if (commandBuffer.PendingImageBarriers.empty() && commandBuffer.PendingBufferBarriers.empty()) {
+            return;
+        }
+
+        const VkDependencyInfo barrierDependency {
+            .sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
+            .pNext = nullptr,
+            .dependencyFlags = 0,
+            .memoryBarrierCount = 0,
+            .pMemoryBarriers = nullptr,
+            .bufferMemoryBarrierCount = static_cast<uint32_t>(commandBuffer.PendingBufferBarriers.size()),
+            .pBufferMemoryBarriers = commandBuffer.PendingBufferBarriers.data(),
+            .imageMemoryBarrierCount = static_cast<uint32_t>(commandBuffer.PendingImageBarriers.size()),
+            .pImageMemoryBarriers = commandBuffer.PendingImageBarriers.data(),
+        };
+        vkCmdPipelineBarrier2(commandBuffer.CommandBuffer, &barrierDependency);
+
+        commandBuffer.PendingImageBarriers.clear();
+        commandBuffer.PendingBufferBarriers.clear();
+    }
+
+    static TextureSubresourceStateVulkan ConvertTextureStateToVulkan(const TextureState state) {
+        switch (state) {
+            case TextureState::Undefined:
+                return {};
+            case TextureState::ColorAttachment:
+                return {
+                    .Layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+                    .Stages = VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT,
+                    .Access = VK_ACCESS_2_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT,
+                };
+            case TextureState::DepthStencilAttachment:
+                return {
+                    .Layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+                    .Stages =
+                        VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT,
+                    .Access = VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT |
+                              VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT,
+                };
+            case TextureState::ShaderRead:
+                return {
+                    .Layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                    .Stages = VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT |
+                              VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,
+                    .Access = VK_ACCESS_2_SHADER_READ_BIT,
+                };
+            case TextureState::ComputeStorage:
+                return {
+                    .Layout = VK_IMAGE_LAYOUT_GENERAL,
+                    .Stages = VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,
+                    .Access = VK_ACCESS_2_SHADER_READ_BIT | VK_ACCESS_2_SHADER_WRITE_BIT,
+                };
+            case TextureState::TransferSrc:
+                return {
+                    .Layout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                    .Stages = VK_PIPELINE_STAGE_2_TRANSFER_BIT,
+                    .Access = VK_ACCESS_2_TRANSFER_READ_BIT,
+                };
+            case TextureState::TransferDst:
+                return {
+                    .Layout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                    .Stages = VK_PIPELINE_STAGE_2_TRANSFER_BIT,
+                    .Access = VK_ACCESS_2_TRANSFER_WRITE_BIT,
+                };
+            case TextureState::Present:
+                return {.Layout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR};
+        }
+        return {};
+    }
+
+    static constexpr VkAccessFlags2 WriteAccessMask =
+        VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT |
+        VK_ACCESS_2_SHADER_WRITE_BIT | VK_ACCESS_2_TRANSFER_WRITE_BIT | VK_ACCESS_2_HOST_WRITE_BIT |
+        VK_ACCESS_2_MEMORY_WRITE_BIT;
+
+    void RHIDeviceVulkan::TransitionTexture(const RHIFrameContext& frameContext,
+                                            const RHITextureHandle& textureHandle,
+                                            TextureState newState,
+                                            const TextureSubresourceRange& subresourceRange) {
+        OZZ_PROFILE_FUNCTION;
+        transitionTextureInternal(
+            *commandBufferResourcePool.Get(frameContext.GetCommandBuffer()), textureHandle, newState, subresourceRange);
+    }
+
+    void RHIDeviceVulkan::transitionTextureInternal(RHICommandBufferVulkan& commandBuffer,
+                                                    const RHITextureHandle& textureHandle,
+                                                    TextureState newState,
+                                                    const TextureSubresourceRange& subresourceRange) {
+        auto* texture = texturePool.Get(textureHandle);
+        if (!texture) {
+            spdlog::error("TransitionTexture: invalid texture handle");
+            return;
+        }
+
+        VkImageAspectFlags aspect = VK_IMAGE_ASPECT_COLOR_BIT;
+        if (HasStencilComponent(texture->Format)) {
+            aspect = VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
+        } else if (texture->Format == VK_FORMAT_D32_SFLOAT || texture->Format == VK_FORMAT_D16_UNORM) {
+            aspect = VK_IMAGE_ASPECT_DEPTH_BIT;
+        }
+        const auto target = ConvertTextureStateToVulkan(newState);
+        const bool bTargetWrites = (target.Access & WriteAccessMask) != 0;
+
+        const uint32_t lastMip =
+            std::min(subresourceRange.BaseMipLevel + subresourceRange.LevelCount, texture->MipLevels);
+        const uint32_t lastLayer =
+            std::min(subresourceRange.BaseArrayLayer + subresourceRange.LayerCount, texture->ArrayLayers);
+
+        std::lock_guard lock(textureStateMutex);
+        for (uint32_t layer = subresourceRange.BaseArrayLayer; layer < lastLayer; ++layer) {
+            for (uint32_t mip = subresourceRange.BaseMipLevel; mip < lastMip; ++mip) {
+                auto& current = texture->SubresourceStates[layer * texture->MipLevels + mip];
+
+                // Discarding records nothing: the next transition starts from UNDEFINED but still
+                // waits for the stages that used the previous contents.
+                if (newState == TextureState::Undefined) {
+                    current.Layout = VK_IMAGE_LAYOUT_UNDEFINED;
+                    continue;
+                }
+
+                // Reading again in the same layout needs no barrier; the next writer waits for
+                // every stage that read since the last write.
+                if (current.Layout == target.Layout && (current.Access & WriteAccessMask) == 0 && !bTargetWrites) {
+                    current.Stages |= target.Stages;
+                    current.Access |= target.Access;
+                    continue;
+                }
+
+                commandBuffer.PendingImageBarriers.push_back({
+                    .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2,
+                    .pNext = nullptr,
+                    .srcStageMask = current.Stages,
+                    // Only writes have to be made available; reads just need the execution dependency
+                    .srcAccessMask = current.Access & WriteAccessMask,
+                    .dstStageMask = target.Stages,
+                    .dstAccessMask = target.Access,
+                    .oldLayout = current.Layout,
+                    .newLayout = target.Layout,
+                    .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                    .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                    .image = texture->Image,
+                    .subresourceRange =
+                        {
+                            .aspectMask = aspect,
+                            .baseMipLevel = mip,
+                            .levelCount = 1,
+                            .baseArrayLayer = layer,
+                            .layerCount = 1,
+                        },
+                });
+                current = target;
+            }
+        }
+    }
+
+    void RHIDeviceVulkan::trackTextureBarrier(const VkImageMemoryBarrier2& barrier,
+                                              const RHITextureHandle& textureHandle) {
+        auto* texture = texturePool.Get(textureHandle);
+        if (!texture) {
+            return;
+        }
+        const auto& range = barrier.subresourceRange;
+        const uint32_t lastMip = range.levelCount == VK_REMAINING_MIP_LEVELS
+                                     ? texture->MipLevels
+                                     : std::min(range.baseMipLevel + range.levelCount, texture->MipLevels);
+        const uint32_t lastLayer = range.layerCount == VK_REMAINING_ARRAY_LAYERS
+                                       ? texture->ArrayLayers
+                                       : std::min(range.baseArrayLayer + range.layerCount, texture->ArrayLayers);
+
+        std::lock_guard lock(textureStateMutex);
+        for (uint32_t layer = range.baseArrayLayer; layer < lastLayer; ++layer) {
+            for (uint32_t mip = range.baseMipLevel; mip < lastMip; ++mip) {
+                auto& current = texture->SubresourceStates[layer * texture->MipLevels + mip];
+#ifdef OZZ_DEBUG
+                // Both halves of a queue family ownership transfer carry the same oldLayout
+                const bool bOwnershipTransfer = barrier.srcQueueFamilyIndex != barrier.dstQueueFamilyIndex;
+                if (barrier.oldLayout != VK_IMAGE_LAYOUT_UNDEFINED && barrier.oldLayout != current.Layout &&
+                    !bOwnershipTransfer) {
+                    spdlog::warn("Texture barrier from layout {} but mip {} layer {} is tracked in layout {}",
+                                 static_cast<int>(barrier.oldLayout),
+                                 mip,
+                                 layer,
+                                 static_cast<int>(current.Layout));
+                }
+#endif
+                current = {
+                    .Layout = barrier.newLayout,
+                    .Stages = barrier.dstStageMask,
+                    .Access = barrier.dstAccessMask,
+                };
+            }
+        }
     }
 
     void RHIDeviceVulkan::textureResourceBarrierInternal(VkCommandBuffer cmd,
                                                          const TextureBarrierDescriptor& barrierDescriptor) {
-        VkImageMemoryBarrier2 imageMemoryBarrier {
+        const auto imageMemoryBarrier = convertTextureBarrier(barrierDescriptor);
+        if (!imageMemoryBarrier) {
+            return;
+        }
+        trackTextureBarrier(*imageMemoryBarrier, barrierDescriptor.Texture);
+        recordTextureBarrierInternal(cmd, *imageMemoryBarrier);
+    }
+
+    void RHIDeviceVulkan::recordTextureBarrierInternal(VkCommandBuffer cmd, const VkImageMemoryBarrier2& barrier) {
+        const VkDependencyInfo barrierDependency {
+            .sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
+            .pNext = nullptr,
+            .dependencyFlags = 0,
+            .memoryBarrierCount = 0,
+            .pMemoryBarriers = nullptr,
+            .bufferMemoryBarrierCount = 0,
+            .pBufferMemoryBarriers = nullptr,
+            .imageMemoryBarrierCount = 1,
+            .pImageMemoryBarriers = &barrier,
+        };
+
+        vkCmdPipelineBarrier2(cmd, &barrierDependency);
+    }
+
+    std::optional<VkImageMemoryBarrier2>
+    RHIDeviceVulkan::convertTextureBarrier(const TextureBarrierDescriptor& barrierDescriptor) {
+        const auto* texture = texturePool.Get(barrierDescriptor.Texture);
+        if (!texture) {
+            spdlog::error("TextureResourceBarrier: invalid texture handle");
+            return std::nullopt;
+        }
+
+        return VkImageMemoryBarrier2 {
             .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2,
             .pNext = nullptr,
             .srcStageMask = ConvertPipelineStageToVulkan(barrierDescriptor.SrcStage),
@@ -1260,7 +2401,7 @@ namespace OZZ::rendering::vk {
             .dstQueueFamilyIndex = barrierDescriptor.DstQueueFamily == QueueFamilyIgnored
                                        ? VK_QUEUE_FAMILY_IGNORED
                                        : static_cast<uint32_t>(barrierDescriptor.DstQueueFamily),
-            .image = texturePool.Get(barrierDescriptor.Texture)->Image,
+            .image = texture->Image,
             .subresourceRange =
                 {
                     .aspectMask = ConvertTextureAspectToVulkan(barrierDescriptor.SubresourceRange.Aspect),
@@ -1270,29 +2411,37 @@ namespace OZZ::rendering::vk {
                     .layerCount = barrierDescriptor.SubresourceRange.LayerCount,
                 },
         };
-        VkDependencyInfo barrierDependency {
-            .sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
-            .pNext = nullptr,
-            .dependencyFlags = 0,
-            .memoryBarrierCount = 0,
-            .pMemoryBarriers = nullptr,
-            .bufferMemoryBarrierCount = 0,
-            .pBufferMemoryBarriers = nullptr,
-            .imageMemoryBarrierCount = 1,
-            .pImageMemoryBarriers = &imageMemoryBarrier, // to be filled out based on the TextureBarrierDescriptor
-        };
-
-        vkCmdPipelineBarrier2(cmd, &barrierDependency);
     }
 
-    void RHIDeviceVulkan::BufferMemoryBarrier(const RHIFrameContext& frameContext,
-                                              const BufferBarrierDescriptor& barrierDescriptor) {
-        bufferMemoryBarrierInternal(*commandBufferResourcePool.Get(frameContext.GetCommandBuffer()), barrierDescriptor);
-    }
+    std::optional<VkBufferMemoryBarrier2>
+    RHIDeviceVulkan::convertBufferBarrier(const BufferBarrierDescriptor& barrierDescriptor, uint32_t frameIndex) {
+        const auto* buffers = bufferResourcePool.Get(barrierDescriptor.Buffer);
+        if (!buffers) {
+            spdlog::error("BufferMemoryBarrier: invalid buffer handle");
+            return std::nullopt;
+        }
+        // The copy GPU writes land in, as for descriptors and indirect arguments: copy 0, or the
+        // recording frame's copy of a Stream buffer
+        const auto& buffer = buffers->front().Lifetime == BufferLifetime::Stream ? resolveBuffer(*buffers, frameIndex)
+                                                                                 : buffers->front();
 
-    void RHIDeviceVulkan::bufferMemoryBarrierInternal(VkCommandBuffer /*cmd*/,
-                                                      const BufferBarrierDescriptor& /*barrierDescriptor*/) {
-        assert(false && "Buffer memory barriers not implemented!!");
+        return VkBufferMemoryBarrier2 {
+            .sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2,
+            .pNext = nullptr,
+            .srcStageMask = ConvertPipelineStageToVulkan(barrierDescriptor.SrcStage),
+            .srcAccessMask = ConvertAccessToVulkan(barrierDescriptor.SrcAccess),
+            .dstStageMask = ConvertPipelineStageToVulkan(barrierDescriptor.DstStage),
+            .dstAccessMask = ConvertAccessToVulkan(barrierDescriptor.DstAccess),
+            .srcQueueFamilyIndex = barrierDescriptor.SrcQueueFamily == QueueFamilyIgnored
+                                       ? VK_QUEUE_FAMILY_IGNORED
+                                       : static_cast<uint32_t>(barrierDescriptor.SrcQueueFamily),
+            .dstQueueFamilyIndex = barrierDescriptor.DstQueueFamily == QueueFamilyIgnored
+                                       ? VK_QUEUE_FAMILY_IGNORED
+                                       : static_cast<uint32_t>(barrierDescriptor.DstQueueFamily),
+            .buffer = buffer.Buffer,
+            .offset = barrierDescriptor.Offset,
+            .size = barrierDescriptor.Size == 0 ? VK_WHOLE_SIZE : barrierDescriptor.Size,
+        };
     }
 
     // ============================================================
@@ -1300,7 +2449,7 @@ namespace OZZ::rendering::vk {
     // ============================================================
 
     void RHIDeviceVulkan::SetViewport(const RHIFrameContext& frameContext, const Viewport& viewport) {
-        setViewportInternal(*commandBufferResourcePool.Get(frameContext.GetCommandBuffer()), viewport);
+        setViewportInternal(commandBufferResourcePool.Get(frameContext.GetCommandBuffer())->CommandBuffer, viewport);
     }
 
     void RHIDeviceVulkan::setViewportInternal(VkCommandBuffer cmd, const Viewport& viewport) {
@@ -1318,7 +2467,7 @@ namespace OZZ::rendering::vk {
     }
 
     void RHIDeviceVulkan::SetScissor(const RHIFrameContext& frameContext, const Scissor& scissor) {
-        setScissorInternal(*commandBufferResourcePool.Get(frameContext.GetCommandBuffer()), scissor);
+        setScissorInternal(commandBufferResourcePool.Get(frameContext.GetCommandBuffer())->CommandBuffer, scissor);
     }
 
     void RHIDeviceVulkan::setScissorInternal(VkCommandBuffer cmd, const Scissor& scissor) {
@@ -1337,118 +2486,339 @@ namespace OZZ::rendering::vk {
         vkCmdSetScissorWithCount(cmd, 1, &vkScissor);
     }
 
+    static void ConvertColorBlendToVulkan(const ColorBlendAttachmentState* attachments,
+                                          const uint32_t attachmentCount,
+                                          VkBool32* blendEnables,
+                                          VkColorComponentFlags* colorWriteMasks,
+                                          VkColorBlendEquationEXT* blendEquations) {
+        for (uint32_t i = 0; i < attachmentCount; ++i) {
+            const auto& src = attachments[i];
+            blendEnables[i] = src.BlendEnable;
+            colorWriteMasks[i] = ConvertColorComponentFlagsToVulkan(src.ColorWriteMask);
+            blendEquations[i] = {
+                .srcColorBlendFactor = ConvertBlendFactorToVulkan(src.SrcColorFactor),
+                .dstColorBlendFactor = ConvertBlendFactorToVulkan(src.DstColorFactor),
+                .colorBlendOp = ConvertBlendOpToVulkan(src.ColorBlendOp),
+                .srcAlphaBlendFactor = ConvertBlendFactorToVulkan(src.SrcAlphaFactor),
+                .dstAlphaBlendFactor = ConvertBlendFactorToVulkan(src.DstAlphaFactor),
+                .alphaBlendOp = ConvertBlendOpToVulkan(src.AlphaBlendOp),
+            };
+        }
+    }
+
+    static void ConvertVertexInputToVulkan(const VertexInputState& vertexInput,
+                                           VkVertexInputBindingDescription2EXT* bindings,
+                                           VkVertexInputAttributeDescription2EXT* attributes) {
+        for (uint32_t i = 0; i < vertexInput.BindingCount; ++i) {
+            const auto& src = vertexInput.Bindings[i];
+            bindings[i] = {
+                .sType = VK_STRUCTURE_TYPE_VERTEX_INPUT_BINDING_DESCRIPTION_2_EXT,
+                .pNext = nullptr,
+                .binding = src.Binding,
+                .stride = src.Stride,
+                .inputRate = ConvertVertexInputRateToVulkan(src.InputRate),
+                .divisor = 1,
+            };
+        }
+        for (uint32_t i = 0; i < vertexInput.AttributeCount; ++i) {
+            const auto& src = vertexInput.Attributes[i];
+            attributes[i] = {
+                .sType = VK_STRUCTURE_TYPE_VERTEX_INPUT_ATTRIBUTE_DESCRIPTION_2_EXT,
+                .pNext = nullptr,
+                .location = src.Location,
+                .binding = src.Binding,
+                .format = ConvertVertexFormatToVulkan(src.Format),
+                .offset = src.Offset,
+            };
+        }
+    }
+
+    static RHIGraphicsStateVulkan BuildGraphicsStateVulkan(const GraphicsStateDescriptor& descriptor) {
+        RHIGraphicsStateVulkan state {.Descriptor = descriptor};
+
+        state.Topology = ConvertPrimitiveTopologyToVulkan(descriptor.InputAssembly.Topology);
+        state.CullMode = ConvertCullModeToVulkan(descriptor.Rasterization.Cull);
+        state.FrontFace = ConvertFrontFaceToVulkan(descriptor.Rasterization.Front);
+        state.PolygonMode = ConvertPolygonModeToVulkan(descriptor.Rasterization.Polygon);
+
+        const auto& depthStencil = descriptor.DepthStencil;
+        state.DepthCompareOp = ConvertCompareOpToVulkan(depthStencil.DepthCompareOp);
+        state.StencilFaceMask = ConvertStencilFaceToVulkan(depthStencil.StencilFaceMask);
+        state.StencilFailOp = ConvertStencilOpToVulkan(depthStencil.StencilFailOp);
+        state.StencilPassOp = ConvertStencilOpToVulkan(depthStencil.StencilPassOp);
+        state.StencilDepthFailOp = ConvertStencilOpToVulkan(depthStencil.StencilDepthFailOp);
+        state.StencilCompareOp = ConvertCompareOpToVulkan(depthStencil.StencilCompareOp);
+        state.StencilWriteMask = ConvertStencilBitToVulkan(depthStencil.StencilWriteMask);
+
+        state.RasterizationSamples = ConvertSampleCountToVulkan(descriptor.Multisample.Samples);
+
+        ConvertColorBlendToVulkan(descriptor.ColorBlend,
+                                  descriptor.ColorBlendAttachmentCount,
+                                  state.BlendEnables.data(),
+                                  state.ColorWriteMasks.data(),
+                                  state.BlendEquations.data());
+        ConvertVertexInputToVulkan(descriptor.VertexInput, state.VertexBindings.data(), state.VertexAttributes.data());
+
+        // input assembly 2, rasterization 6, depth/stencil enables 3, multisample 3, vertex input 1
+        state.CommandCount = 15;
+        state.CommandCount += depthStencil.DepthTestEnable ? 1 : 0;
+        state.CommandCount += depthStencil.StencilTestEnable ? 4 : 0;
+        state.CommandCount += descriptor.ColorBlendAttachmentCount > 0 ? 3 : 0;
+        return state;
+    }
+
+    RHIGraphicsStateHandle
+    RHIDeviceVulkan::CreateGraphicsState(const GraphicsStateDescriptor& graphicsStateDescriptor) {
+        OZZ_PROFILE_FUNCTION;
+        return graphicsStatePool.Allocate(BuildGraphicsStateVulkan(graphicsStateDescriptor));
+    }
+
+    void RHIDeviceVulkan::FreeGraphicsState(const RHIGraphicsStateHandle& graphicsStateHandle) {
+        OZZ_PROFILE_FUNCTION;
+        graphicsStatePool.Free(graphicsStateHandle);
+    }
+
     void RHIDeviceVulkan::SetGraphicsState(const RHIFrameContext& frameContext,
                                            const GraphicsStateDescriptor& graphicsStateDescriptor) {
         OZZ_PROFILE_FUNCTION;
+        // Converted field by field, and only for the commands that actually get recorded
+        setGraphicsStateInternal(*commandBufferResourcePool.Get(frameContext.GetCommandBuffer()),
+                                 graphicsStateDescriptor,
+                                 nullptr,
+                                 RHIGraphicsStateHandle::Null());
+    }
+
+    void RHIDeviceVulkan::SetGraphicsState(const RHIFrameContext& frameContext,
+                                           const RHIGraphicsStateHandle& graphicsStateHandle) {
+        OZZ_PROFILE_FUNCTION;
+        const auto* graphicsState = graphicsStatePool.Get(graphicsStateHandle);
+        if (!graphicsState) {
+            spdlog::error("SetGraphicsState: invalid graphics state handle");
+            return;
+        }
         setGraphicsStateInternal(*commandBufferResourcePool.Get(frameContext.GetCommandBuffer()),
-                                 graphicsStateDescriptor);
+                                 graphicsState->Descriptor,
+                                 graphicsState,
+                                 graphicsStateHandle);
     }
 
-    void RHIDeviceVulkan::setGraphicsStateInternal(VkCommandBuffer cmd,
-                                                   const GraphicsStateDescriptor& graphicsStateDescriptor) {
+    uint64_t RHIDeviceVulkan::GetElidedStateCommandCount() const {
+        return elidedStateCommands.load(std::memory_order_relaxed);
+    }
+
+    void RHIDeviceVulkan::setGraphicsStateInternal(RHICommandBufferVulkan& commandBuffer,
+                                                   const GraphicsStateDescriptor& state,
+                                                   const RHIGraphicsStateVulkan* compiled,
+                                                   const RHIGraphicsStateHandle& graphicsStateHandle) {
+        const VkCommandBuffer cmd = commandBuffer.CommandBuffer;
         OZZ_GPU_ZONE(tracyGpuContext, cmd, "SetGraphicsState");
-        stateSetThisPass = true;
+        commandBuffer.bStateSetThisPass = true;
+
+        // The same state object again: the command buffer already holds all of it
+        if (commandBuffer.bRecordedStateValid && graphicsStateHandle.IsValid() &&
+            commandBuffer.RecordedStateHandle == graphicsStateHandle) {
+            elidedStateCommands.fetch_add(compiled->CommandCount, std::memory_order_relaxed);
+            return;
+        }
+
+        // Each command is only recorded when its inputs differ from what this command buffer
+        // last recorded. changed() compares and adopts the new value; dirty() also counts the
+        // command as elided when nothing changed.
+        auto& recorded = commandBuffer.RecordedState;
+        const bool bRecordedValid = commandBuffer.bRecordedStateValid;
+        uint64_t elided = 0;
+        const auto changed = [&](auto&& previous, const auto& current) {
+            if (bRecordedValid && previous == current) {
+                return false;
+            }
+            previous = current;
+            return true;
+        };
+        const auto dirty = [&](auto&& previous, const auto& current) {
+            if (changed(previous, current)) {
+                return true;
+            }
+            ++elided;
+            return false;
+        };
+        if (!bRecordedValid) {
+            recorded.ColorBlendAttachmentCount = 0;
+        }
+
         // Input Assembly
-        vkCmdSetPrimitiveTopology(cmd,
-                                  ConvertPrimitiveTopologyToVulkan(graphicsStateDescriptor.InputAssembly.Topology));
-        vkCmdSetPrimitiveRestartEnable(cmd, graphicsStateDescriptor.InputAssembly.PrimitiveRestartEnable);
+        if (dirty(recorded.InputAssembly.Topology, state.InputAssembly.Topology)) {
+            vkCmdSetPrimitiveTopology(
+                cmd, compiled ? compiled->Topology : ConvertPrimitiveTopologyToVulkan(state.InputAssembly.Topology));
+        }
+        if (dirty(recorded.InputAssembly.PrimitiveRestartEnable, state.InputAssembly.PrimitiveRestartEnable)) {
+            vkCmdSetPrimitiveRestartEnable(cmd, state.InputAssembly.PrimitiveRestartEnable);
+        }
 
         // Rasterization
-        vkCmdSetCullMode(cmd, ConvertCullModeToVulkan(graphicsStateDescriptor.Rasterization.Cull));
-        vkCmdSetFrontFace(cmd, ConvertFrontFaceToVulkan(graphicsStateDescriptor.Rasterization.Front));
-        vkCmdSetPolygonModeEXT(cmd, ConvertPolygonModeToVulkan(graphicsStateDescriptor.Rasterization.Polygon));
-        vkCmdSetDepthBiasEnable(cmd, graphicsStateDescriptor.Rasterization.DepthBiasEnable);
-        vkCmdSetRasterizerDiscardEnable(cmd, graphicsStateDescriptor.Rasterization.RasterizerDiscard);
-        vkCmdSetLineWidth(cmd, graphicsStateDescriptor.Rasterization.LineWidth);
-
-        // Depth / Stencil
-        vkCmdSetDepthTestEnable(cmd, graphicsStateDescriptor.DepthStencil.DepthTestEnable);
-        vkCmdSetDepthWriteEnable(cmd, graphicsStateDescriptor.DepthStencil.DepthWriteEnable);
-        vkCmdSetStencilTestEnable(cmd, graphicsStateDescriptor.DepthStencil.StencilTestEnable);
-        if (graphicsStateDescriptor.DepthStencil.DepthTestEnable) {
-            vkCmdSetDepthCompareOp(cmd, ConvertCompareOpToVulkan(graphicsStateDescriptor.DepthStencil.DepthCompareOp));
-        }
-        if (graphicsStateDescriptor.DepthStencil.StencilTestEnable) {
-            vkCmdSetStencilOp(cmd,
-                              ConvertStencilFaceToVulkan(graphicsStateDescriptor.DepthStencil.StencilFaceMask),
-                              ConvertStencilOpToVulkan(graphicsStateDescriptor.DepthStencil.StencilFailOp),
-                              ConvertStencilOpToVulkan(graphicsStateDescriptor.DepthStencil.StencilPassOp),
-                              ConvertStencilOpToVulkan(graphicsStateDescriptor.DepthStencil.StencilDepthFailOp),
-                              ConvertCompareOpToVulkan(graphicsStateDescriptor.DepthStencil.StencilCompareOp));
-            vkCmdSetStencilCompareMask(
-                cmd,
-                ConvertStencilFaceToVulkan(graphicsStateDescriptor.DepthStencil.StencilFaceMask),
-
-                ConvertStencilBitToVulkan(graphicsStateDescriptor.DepthStencil.StencilWriteMask));
-
-            vkCmdSetStencilReference(cmd,
-                                     ConvertStencilFaceToVulkan(graphicsStateDescriptor.DepthStencil.StencilFaceMask),
-                                     0);
-            vkCmdSetStencilWriteMask(cmd,
-                                     ConvertStencilFaceToVulkan(graphicsStateDescriptor.DepthStencil.StencilFaceMask),
-                                     ConvertStencilBitToVulkan(graphicsStateDescriptor.DepthStencil.StencilWriteMask));
+        if (dirty(recorded.Rasterization.Cull, state.Rasterization.Cull)) {
+            vkCmdSetCullMode(cmd, compiled ? compiled->CullMode : ConvertCullModeToVulkan(state.Rasterization.Cull));
+        }
+        if (dirty(recorded.Rasterization.Front, state.Rasterization.Front)) {
+            vkCmdSetFrontFace(cmd,
+                              compiled ? compiled->FrontFace : ConvertFrontFaceToVulkan(state.Rasterization.Front));
+        }
+        if (dirty(recorded.Rasterization.Polygon, state.Rasterization.Polygon)) {
+            vkCmdSetPolygonModeEXT(
+                cmd, compiled ? compiled->PolygonMode : ConvertPolygonModeToVulkan(state.Rasterization.Polygon));
+        }
+        if (dirty(recorded.Rasterization.DepthBiasEnable, state.Rasterization.DepthBiasEnable)) {
+            vkCmdSetDepthBiasEnable(cmd, state.Rasterization.DepthBiasEnable);
+        }
+        if (dirty(recorded.Rasterization.RasterizerDiscard, state.Rasterization.RasterizerDiscard)) {
+            vkCmdSetRasterizerDiscardEnable(cmd, state.Rasterization.RasterizerDiscard);
+        }
+        if (dirty(recorded.Rasterization.LineWidth, state.Rasterization.LineWidth)) {
+            vkCmdSetLineWidth(cmd, state.Rasterization.LineWidth);
+        }
+
+        // Depth / Stencil. The compare op and stencil parameters are skipped while their test is
+        // disabled, except on a fresh command buffer, so the recorded copy always holds values
+        // that were actually set.
+        const auto& depthStencil = state.DepthStencil;
+        auto& recordedDepthStencil = recorded.DepthStencil;
+        if (dirty(recordedDepthStencil.DepthTestEnable, depthStencil.DepthTestEnable)) {
+            vkCmdSetDepthTestEnable(cmd, depthStencil.DepthTestEnable);
+        }
+        if (dirty(recordedDepthStencil.DepthWriteEnable, depthStencil.DepthWriteEnable)) {
+            vkCmdSetDepthWriteEnable(cmd, depthStencil.DepthWriteEnable);
+        }
+        if (dirty(recordedDepthStencil.StencilTestEnable, depthStencil.StencilTestEnable)) {
+            vkCmdSetStencilTestEnable(cmd, depthStencil.StencilTestEnable);
+        }
+        if ((depthStencil.DepthTestEnable || !bRecordedValid) &&
+            dirty(recordedDepthStencil.DepthCompareOp, depthStencil.DepthCompareOp)) {
+            vkCmdSetDepthCompareOp(
+                cmd, compiled ? compiled->DepthCompareOp : ConvertCompareOpToVulkan(depthStencil.DepthCompareOp));
+        }
+        if (depthStencil.StencilTestEnable || !bRecordedValid) {
+            const auto faceMask =
+                compiled ? compiled->StencilFaceMask : ConvertStencilFaceToVulkan(depthStencil.StencilFaceMask);
+            // The recorded values were set for the recorded face mask; a different one re-records them all
+            const bool bFaceChanged = changed(recordedDepthStencil.StencilFaceMask, depthStencil.StencilFaceMask);
+            const bool bOpsChanged = changed(std::tie(recordedDepthStencil.StencilFailOp,
+                                                      recordedDepthStencil.StencilPassOp,
+                                                      recordedDepthStencil.StencilDepthFailOp,
+                                                      recordedDepthStencil.StencilCompareOp),
+                                             std::tie(depthStencil.StencilFailOp,
+                                                      depthStencil.StencilPassOp,
+                                                      depthStencil.StencilDepthFailOp,
+                                                      depthStencil.StencilCompareOp)) ||
+                                     bFaceChanged;
+            const bool bMaskChanged =
+                changed(recordedDepthStencil.StencilWriteMask, depthStencil.StencilWriteMask) || bFaceChanged;
+            if (bOpsChanged) {
+                if (compiled) {
+                    vkCmdSetStencilOp(cmd,
+                                      faceMask,
+                                      compiled->StencilFailOp,
+                                      compiled->StencilPassOp,
+                                      compiled->StencilDepthFailOp,
+                                      compiled->StencilCompareOp);
+                } else {
+                    vkCmdSetStencilOp(cmd,
+                                      faceMask,
+                                      ConvertStencilOpToVulkan(depthStencil.StencilFailOp),
+                                      ConvertStencilOpToVulkan(depthStencil.StencilPassOp),
+                                      ConvertStencilOpToVulkan(depthStencil.StencilDepthFailOp),
+                                      ConvertCompareOpToVulkan(depthStencil.StencilCompareOp));
+                }
+            } else {
+                ++elided;
+            }
+            if (bMaskChanged) {
+                const uint32_t writeMask =
+                    compiled ? compiled->StencilWriteMask : ConvertStencilBitToVulkan(depthStencil.StencilWriteMask);
+                vkCmdSetStencilCompareMask(cmd, faceMask, writeMask);
+                vkCmdSetStencilWriteMask(cmd, faceMask, writeMask);
+            } else {
+                elided += 2;
+            }
+            if (bFaceChanged) {
+                vkCmdSetStencilReference(cmd, faceMask, 0);
+            } else {
+                ++elided;
+            }
         }
+
         // Multisample
         const VkSampleCountFlagBits sampleCount =
-            ConvertSampleCountToVulkan(graphicsStateDescriptor.Multisample.Samples);
-        const VkSampleMask sampleMask = graphicsStateDescriptor.Multisample.SampleMask;
-        vkCmdSetRasterizationSamplesEXT(cmd, sampleCount);
-        vkCmdSetSampleMaskEXT(cmd, sampleCount, &sampleMask);
-        vkCmdSetAlphaToCoverageEnableEXT(cmd, graphicsStateDescriptor.Multisample.AlphaToCoverageEnable);
+            compiled ? compiled->RasterizationSamples : ConvertSampleCountToVulkan(state.Multisample.Samples);
+        const bool bSamplesChanged = dirty(recorded.Multisample.Samples, state.Multisample.Samples);
+        if (bSamplesChanged) {
+            vkCmdSetRasterizationSamplesEXT(cmd, sampleCount);
+        }
+        // The sample mask is sized by the sample count, so it follows a count change
+        if (changed(recorded.Multisample.SampleMask, state.Multisample.SampleMask) || bSamplesChanged) {
+            const VkSampleMask sampleMask = state.Multisample.SampleMask;
+            vkCmdSetSampleMaskEXT(cmd, sampleCount, &sampleMask);
+        } else {
+            ++elided;
+        }
+        if (dirty(recorded.Multisample.AlphaToCoverageEnable, state.Multisample.AlphaToCoverageEnable)) {
+            vkCmdSetAlphaToCoverageEnableEXT(cmd, state.Multisample.AlphaToCoverageEnable);
+        }
 
         // Color Blend
-        if (graphicsStateDescriptor.ColorBlendAttachmentCount > 0) {
-            VkBool32 blendEnables[MaxBlendAttachments];
-            VkColorComponentFlags colorWriteMasks[MaxBlendAttachments];
-            VkColorBlendEquationEXT blendEquations[MaxBlendAttachments];
-            for (uint32_t i = 0; i < graphicsStateDescriptor.ColorBlendAttachmentCount; ++i) {
-                const auto& src = graphicsStateDescriptor.ColorBlend[i];
-                blendEnables[i] = src.BlendEnable;
-                colorWriteMasks[i] = ConvertColorComponentFlagsToVulkan(src.ColorWriteMask);
-                blendEquations[i] = {
-                    .srcColorBlendFactor = ConvertBlendFactorToVulkan(src.SrcColorFactor),
-                    .dstColorBlendFactor = ConvertBlendFactorToVulkan(src.DstColorFactor),
-                    .colorBlendOp = ConvertBlendOpToVulkan(src.ColorBlendOp),
-                    .srcAlphaBlendFactor = ConvertBlendFactorToVulkan(src.SrcAlphaFactor),
-                    .dstAlphaBlendFactor = ConvertBlendFactorToVulkan(src.DstAlphaFactor),
-                    .alphaBlendOp = ConvertBlendOpToVulkan(src.AlphaBlendOp),
-                };
+        const uint32_t attachmentCount = state.ColorBlendAttachmentCount;
+        if (attachmentCount > 0) {
+            if (bRecordedValid && attachmentCount <= recorded.ColorBlendAttachmentCount &&
+                std::equal(state.ColorBlend, state.ColorBlend + attachmentCount, recorded.ColorBlend)) {
+                elided += 3;
+            } else {
+                if (compiled) {
+                    vkCmdSetColorBlendEnableEXT(cmd, 0, attachmentCount, compiled->BlendEnables.data());
+                    vkCmdSetColorWriteMaskEXT(cmd, 0, attachmentCount, compiled->ColorWriteMasks.data());
+                    vkCmdSetColorBlendEquationEXT(cmd, 0, attachmentCount, compiled->BlendEquations.data());
+                } else {
+                    std::array<VkBool32, MaxBlendAttachments> blendEnables;
+                    std::array<VkColorComponentFlags, MaxBlendAttachments> colorWriteMasks;
+                    std::array<VkColorBlendEquationEXT, MaxBlendAttachments> blendEquations;
+                    ConvertColorBlendToVulkan(state.ColorBlend,
+                                              attachmentCount,
+                                              blendEnables.data(),
+                                              colorWriteMasks.data(),
+                                              blendEquations.data());
+                    vkCmdSetColorBlendEnableEXT(cmd, 0, attachmentCount, blendEnables.data());
+                    vkCmdSetColorWriteMaskEXT(cmd, 0, attachmentCount, colorWriteMasks.data());
+                    vkCmdSetColorBlendEquationEXT(cmd, 0, attachmentCount, blendEquations.data());
+                }
+
+                // Attachments past attachmentCount keep what was recorded for them earlier
+                std::copy_n(state.ColorBlend, attachmentCount, recorded.ColorBlend);
+                recorded.ColorBlendAttachmentCount = std::max(recorded.ColorBlendAttachmentCount, attachmentCount);
             }
-            vkCmdSetColorBlendEnableEXT(cmd, 0, graphicsStateDescriptor.ColorBlendAttachmentCount, blendEnables);
-            vkCmdSetColorWriteMaskEXT(cmd, 0, graphicsStateDescriptor.ColorBlendAttachmentCount, colorWriteMasks);
-            vkCmdSetColorBlendEquationEXT(cmd, 0, graphicsStateDescriptor.ColorBlendAttachmentCount, blendEquations);
         }
 
         // Vertex Input
-        VkVertexInputBindingDescription2EXT bindings[MaxVertexBindings];
-        for (uint32_t i = 0; i < graphicsStateDescriptor.VertexInput.BindingCount; ++i) {
-            const auto& src = graphicsStateDescriptor.VertexInput.Bindings[i];
-            bindings[i] = {
-                .sType = VK_STRUCTURE_TYPE_VERTEX_INPUT_BINDING_DESCRIPTION_2_EXT,
-                .pNext = nullptr,
-                .binding = src.Binding,
-                .stride = src.Stride,
-                .inputRate = ConvertVertexInputRateToVulkan(src.InputRate),
-                .divisor = 1,
-            };
+        if (dirty(recorded.VertexInput, state.VertexInput)) {
+            if (compiled) {
+                vkCmdSetVertexInputEXT(cmd,
+                                       state.VertexInput.BindingCount,
+                                       compiled->VertexBindings.data(),
+                                       state.VertexInput.AttributeCount,
+                                       compiled->VertexAttributes.data());
+            } else {
+                std::array<VkVertexInputBindingDescription2EXT, MaxVertexBindings> vertexBindings;
+                std::array<VkVertexInputAttributeDescription2EXT, MaxVertexAttributes> vertexAttributes;
+                ConvertVertexInputToVulkan(state.VertexInput, vertexBindings.data(), vertexAttributes.data());
+                vkCmdSetVertexInputEXT(cmd,
+                                       state.VertexInput.BindingCount,
+                                       vertexBindings.data(),
+                                       state.VertexInput.AttributeCount,
+                                       vertexAttributes.data());
+            }
         }
-        VkVertexInputAttributeDescription2EXT attributes[MaxVertexAttributes];
-        for (uint32_t i = 0; i < graphicsStateDescriptor.VertexInput.AttributeCount; ++i) {
-            const auto& src = graphicsStateDescriptor.VertexInput.Attributes[i];
-            attributes[i] = {
-                .sType = VK_STRUCTURE_TYPE_VERTEX_INPUT_ATTRIBUTE_DESCRIPTION_2_EXT,
-                .pNext = nullptr,
-                .location = src.Location,
-                .binding = src.Binding,
-                .format = ConvertVertexFormatToVulkan(src.Format),
-                .offset = src.Offset,
-            };
+
+        commandBuffer.bRecordedStateValid = true;
+        commandBuffer.RecordedStateHandle = graphicsStateHandle;
+        if (elided > 0) {
+            elidedStateCommands.fetch_add(elided, std::memory_order_relaxed);
         }
-        vkCmdSetVertexInputEXT(cmd,
-                               graphicsStateDescriptor.VertexInput.BindingCount,
-                               bindings,
-                               graphicsStateDescriptor.VertexInput.AttributeCount,
-                               attributes);
     }
 
     // ============================================================
@@ -1460,16 +2830,35 @@ namespace OZZ::rendering::vk {
         bindShaderInternal(*commandBufferResourcePool.Get(frameContext.GetCommandBuffer()), shaderHandle);
     }
 
-    void RHIDeviceVulkan::bindShaderInternal(VkCommandBuffer cmd, const RHIShaderHandle& shaderHandle) {
-        OZZ_GPU_ZONE(tracyGpuContext, cmd, "BindShader");
-        if (const auto* shader = shaderResourcePool.Get(shaderHandle)) {
-            shader->Bind(device, cmd);
+    void RHIDeviceVulkan::bindShaderInternal(const RHICommandBufferVulkan& commandBuffer,
+                                             const RHIShaderHandle& shaderHandle) {
+        const VkCommandBuffer cmd = commandBuffer.CommandBuffer;
+        OZZ_GPU_ZONE(profilingContext(commandBuffer), cmd, "BindShader");
+        const auto* shader = shaderResourcePool.Get(shaderHandle);
+        if (!shader) {
+            return;
+        }
+        shader->Bind(device, cmd);
+
+        // Bound once per shader rather than per draw; draws reach their resources through
+        // bindless indices
+        const auto* layout = pipelineLayoutResourcePool.Get(shader->pipelineLayoutHandle);
+        if (layout && layout->BindlessSet) {
+            const VkDescriptorSet bindlessDescriptorSet = bindlessHeap.Set();
+            vkCmdBindDescriptorSets(cmd,
+                                    layout->BindPoint,
+                                    layout->Layout,
+                                    *layout->BindlessSet,
+                                    1,
+                                    &bindlessDescriptorSet,
+                                    0,
+                                    nullptr);
         }
     }
 
     void RHIDeviceVulkan::BindBuffer(const RHIFrameContext& frameContext, const RHIBufferHandle& bufferHandle) {
         OZZ_PROFILE_FUNCTION;
-        bindBufferInternal(*commandBufferResourcePool.Get(frameContext.GetCommandBuffer()),
+        bindBufferInternal(commandBufferResourcePool.Get(frameContext.GetCommandBuffer())->CommandBuffer,
                            bufferHandle,
                            GetFrameNumberFromFrameContext(frameContext));
     }
@@ -1482,28 +2871,108 @@ namespace OZZ::rendering::vk {
             return;
         }
 
-        const auto buffer = (*buffers)[frameIndex];
+        const auto usage = buffers->front().Usage;
 
-        if (has(buffer.Usage, BufferUsage::VertexBuffer)) {
-            VkDeviceSize sizes[] = {0};
-            vkCmdBindVertexBuffers2(cmd, 0, 1, &buffer.Buffer, sizes, nullptr, nullptr);
+        if (has(usage, BufferUsage::VertexBuffer)) {
+            bindVertexBuffersInternal(cmd, 0, {&bufferHandle, 1}, {}, frameIndex);
             return;
         }
 
-        if (has(buffer.Usage, BufferUsage::IndexBuffer)) {
-            vkCmdBindIndexBuffer(cmd, buffer.Buffer, 0, VK_INDEX_TYPE_UINT32);
+        if (has(usage, BufferUsage::IndexBuffer)) {
+            bindIndexBufferInternal(cmd, bufferHandle, 0, IndexType::UInt32, frameIndex);
             return;
         }
         assert(false && "Buffer type not implemented.");
     }
 
+    void RHIDeviceVulkan::BindVertexBuffers(const RHIFrameContext& frameContext,
+                                            uint32_t firstBinding,
+                                            std::span<const RHIBufferHandle> bufferHandles,
+                                            std::span<const uint64_t> offsets) {
+        OZZ_PROFILE_FUNCTION;
+        bindVertexBuffersInternal(commandBufferResourcePool.Get(frameContext.GetCommandBuffer())->CommandBuffer,
+                                  firstBinding,
+                                  bufferHandles,
+                                  offsets,
+                                  GetFrameNumberFromFrameContext(frameContext));
+    }
+
+    void RHIDeviceVulkan::BindIndexBuffer(const RHIFrameContext& frameContext,
+                                          const RHIBufferHandle& bufferHandle,
+                                          uint64_t offset,
+                                          IndexType indexType) {
+        OZZ_PROFILE_FUNCTION;
+        bindIndexBufferInternal(commandBufferResourcePool.Get(frameContext.GetCommandBuffer())->CommandBuffer,
+                                bufferHandle,
+                                offset,
+                                indexType,
+                                GetFrameNumberFromFrameContext(frameContext));
+    }
+
+    void RHIDeviceVulkan::bindVertexBuffersInternal(VkCommandBuffer cmd,
+                                                    uint32_t firstBinding,
+                                                    std::span<const RHIBufferHandle> bufferHandles,
+                                                    std::span<const uint64_t> offsets,
+                                                    uint32_t frameIndex) {
+        if (bufferHandles.empty()) {
+            return;
+        }
+        if (firstBinding + bufferHandles.size() > MaxVertexBindings) {
+            spdlog::error("BindVertexBuffers: bindings {}..{} exceed MaxVertexBindings ({})",
+                          firstBinding,
+                          firstBinding + bufferHandles.size() - 1,
+                          MaxVertexBindings);
+            return;
+        }
+        if (!offsets.empty() && offsets.size() != bufferHandles.size()) {
+            spdlog::error("BindVertexBuffers: {} offsets given for {} buffers", offsets.size(), bufferHandles.size());
+            return;
+        }
+
+        std::array<VkBuffer, MaxVertexBindings> vkBuffers {};
+        std::array<VkDeviceSize, MaxVertexBindings> vkOffsets {};
+        for (size_t i = 0; i < bufferHandles.size(); ++i) {
+            const auto* buffers = bufferResourcePool.Get(bufferHandles[i]);
+            if (!buffers || !has(buffers->front().Usage, BufferUsage::VertexBuffer)) {
+                spdlog::error("BindVertexBuffers: buffer for binding {} is invalid or not a vertex buffer",
+                              firstBinding + i);
+                return;
+            }
+            vkBuffers[i] = resolveBuffer(*buffers, frameIndex).Buffer;
+            vkOffsets[i] = offsets.empty() ? 0 : offsets[i];
+        }
+
+        vkCmdBindVertexBuffers2(cmd,
+                                firstBinding,
+                                static_cast<uint32_t>(bufferHandles.size()),
+                                vkBuffers.data(),
+                                vkOffsets.data(),
+                                nullptr,
+                                nullptr);
+    }
+
+    void RHIDeviceVulkan::bindIndexBufferInternal(VkCommandBuffer cmd,
+                                                  const RHIBufferHandle& bufferHandle,
+                                                  uint64_t offset,
+                                                  IndexType indexType,
+                                                  uint32_t frameIndex) {
+        const auto* buffers = bufferResourcePool.Get(bufferHandle);
+        if (!buffers || !has(buffers->front().Usage, BufferUsage::IndexBuffer)) {
+            spdlog::error("BindIndexBuffer: buffer handle is invalid or not an index buffer");
+            return;
+        }
+
+        vkCmdBindIndexBuffer(
+            cmd, resolveBuffer(*buffers, frameIndex).Buffer, offset, ConvertIndexTypeToVulkan(indexType));
+    }
+
     void RHIDeviceVulkan::SetPushConstants(const RHIFrameContext& frameContext,
                                            RHIPipelineLayoutHandle pipelineLayoutHandle,
                                            ShaderStageFlags stageFlags,
                                            uint32_t offset,
                                            uint32_t size,
                                            const void* data) {
-        setPushConstantsInternal(*commandBufferResourcePool.Get(frameContext.GetCommandBuffer()),
+        setPushConstantsInternal(commandBufferResourcePool.Get(frameContext.GetCommandBuffer())->CommandBuffer,
                                  pipelineLayoutHandle,
                                  stageFlags,
                                  offset,
@@ -1522,31 +2991,77 @@ namespace OZZ::rendering::vk {
             spdlog::error("SetPushConstants: invalid command buffer or pipeline layout handle");
             return;
         }
-        vkCmdPushConstants(cmd, *layout, ConvertShaderStageFlagsToVulkan(stageFlags), offset, size, data);
+        vkCmdPushConstants(cmd, layout->Layout, ConvertShaderStageFlagsToVulkan(stageFlags), offset, size, data);
     }
 
     void RHIDeviceVulkan::BindDescriptorSet(const RHIFrameContext& frameContext,
                                             RHIPipelineLayoutHandle pipelineLayoutHandle,
                                             uint32_t setIndex,
-                                            RHIDescriptorSetHandle descriptorSetHandle) {
+                                            RHIDescriptorSetHandle descriptorSetHandle,
+                                            std::span<const uint32_t> dynamicOffsets) {
         OZZ_PROFILE_FUNCTION;
         bindDescriptorSetInternal(*commandBufferResourcePool.Get(frameContext.GetCommandBuffer()),
                                   pipelineLayoutHandle,
                                   setIndex,
-                                  descriptorSetHandle);
+                                  descriptorSetHandle,
+                                  dynamicOffsets);
     }
 
-    void RHIDeviceVulkan::bindDescriptorSetInternal(VkCommandBuffer cmd,
+    void RHIDeviceVulkan::bindDescriptorSetInternal(RHICommandBufferVulkan& commandBuffer,
                                                     RHIPipelineLayoutHandle pipelineLayoutHandle,
                                                     uint32_t setIndex,
-                                                    RHIDescriptorSetHandle descriptorSetHandle) {
+                                                    RHIDescriptorSetHandle descriptorSetHandle,
+                                                    std::span<const uint32_t> dynamicOffsets) {
         const auto* layout = pipelineLayoutResourcePool.Get(pipelineLayoutHandle);
         const auto* set = descriptorSetResourcePool.Get(descriptorSetHandle);
         if (!layout || !set) {
             spdlog::error("BindDescriptorSet: invalid handle(s)");
             return;
         }
-        vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, *layout, setIndex, 1, set, 0, nullptr);
+        const bool bBufferSet = set->BufferAllocation != VK_NULL_HANDLE;
+        if (bBufferSet != layout->bDescriptorBuffer) {
+            spdlog::error("BindDescriptorSet: set {} and the pipeline layout disagree on using the descriptor buffer",
+                          setIndex);
+            return;
+        }
+        const auto cmd = commandBuffer.CommandBuffer;
+
+        // Descriptor buffer sets have no dynamic bindings; binding one only sets its offset
+        if (bBufferSet) {
+            auto& boundSets = commandBuffer.BoundBufferSets;
+            if (set->BufferIndex >= commandBuffer.DescriptorBuffersBound) {
+                // A buffer added since the last bind. Binding the buffers again drops every
+                // offset set so far, so the sets bound before are set again.
+                commandBuffer.DescriptorBuffersBound = descriptorBuffer.Bind(cmd);
+                for (const auto& bound : boundSets) {
+                    vkCmdSetDescriptorBufferOffsetsEXT(
+                        cmd, bound.BindPoint, bound.Layout, bound.SetIndex, 1, &bound.BufferIndex, &bound.Offset);
+                }
+            }
+            vkCmdSetDescriptorBufferOffsetsEXT(
+                cmd, layout->BindPoint, layout->Layout, setIndex, 1, &set->BufferIndex, &set->BufferOffset);
+
+            std::erase_if(boundSets, [&](const auto& bound) {
+                return bound.BindPoint == layout->BindPoint && bound.SetIndex == setIndex;
+            });
+            boundSets.push_back({
+                .BindPoint = layout->BindPoint,
+                .Layout = layout->Layout,
+                .SetIndex = setIndex,
+                .BufferIndex = set->BufferIndex,
+                .Offset = set->BufferOffset,
+            });
+            return;
+        }
+        // One offset per dynamic binding in the set, in binding order
+        vkCmdBindDescriptorSets(cmd,
+                                layout->BindPoint,
+                                layout->Layout,
+                                setIndex,
+                                1,
+                                &set->Set,
+                                static_cast<uint32_t>(dynamicOffsets.size()),
+                                dynamicOffsets.data());
     }
 
     // ============================================================
@@ -1566,21 +3081,29 @@ namespace OZZ::rendering::vk {
                      firstInstance);
     }
 
-    void RHIDeviceVulkan::drawInternal(VkCommandBuffer cmd,
+    void RHIDeviceVulkan::drawInternal(RHICommandBufferVulkan& commandBuffer,
                                        uint32_t vertexCount,
                                        uint32_t instanceCount,
                                        uint32_t firstVertex,
                                        uint32_t firstInstance) {
+        const VkCommandBuffer cmd = commandBuffer.CommandBuffer;
         OZZ_GPU_ZONE(tracyGpuContext, cmd, "Draw");
+        // A pass begun with ParallelRecording only accepts vkCmdExecuteCommands; recording a
+        // draw inline would be invalid usage, so this one is dropped.
+        if (commandBuffer.bParallelRenderPass) {
+            spdlog::error("Draw recorded on the owning context of a parallel render pass; use a forked context");
+            return;
+        }
         // Unlike WebGPU, the draw is NOT skipped here: Vulkan dynamic state lives in the
         // command buffer and cannot be cheaply reset per pass, so release builds keep the
         // (stale-state-inheriting) behavior. The assert catches the portability bug.
-        if (!stateSetThisPass) {
+        if (!commandBuffer.bStateSetThisPass) {
             spdlog::error("Draw issued without SetGraphicsState in current render pass");
 #ifdef OZZ_DEBUG
             assert(false && "Draw without SetGraphicsState in current render pass");
 #endif
         }
+        flushPendingBarriers(commandBuffer);
         vkCmdDraw(cmd, vertexCount, instanceCount, firstVertex, firstInstance);
     }
 
@@ -1599,23 +3122,237 @@ namespace OZZ::rendering::vk {
                             firstInstance);
     }
 
-    void RHIDeviceVulkan::drawIndexedInternal(VkCommandBuffer cmd,
+    void RHIDeviceVulkan::drawIndexedInternal(RHICommandBufferVulkan& commandBuffer,
                                               uint32_t indexCount,
                                               uint32_t instanceCount,
                                               uint32_t firstIndex,
                                               int32_t vertexOffset,
                                               uint32_t firstInstance) {
+        const VkCommandBuffer cmd = commandBuffer.CommandBuffer;
         OZZ_GPU_ZONE(tracyGpuContext, cmd, "DrawIndexed");
+        if (commandBuffer.bParallelRenderPass) {
+            spdlog::error("DrawIndexed recorded on the owning context of a parallel render pass; use a forked context");
+            return;
+        }
         // See drawInternal: log/assert only, never skip the draw on Vulkan.
-        if (!stateSetThisPass) {
+        if (!commandBuffer.bStateSetThisPass) {
             spdlog::error("Draw issued without SetGraphicsState in current render pass");
 #ifdef OZZ_DEBUG
             assert(false && "Draw without SetGraphicsState in current render pass");
 #endif
         }
+        flushPendingBarriers(commandBuffer);
         vkCmdDrawIndexed(cmd, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
     }
 
+    void RHIDeviceVulkan::DrawIndirect(const RHIFrameContext& frameContext,
+                                       const RHIBufferHandle& argumentBuffer,
+                                       uint64_t offset,
+                                       uint32_t drawCount,
+                                       uint32_t stride) {
+        OZZ_PROFILE_FUNCTION;
+        drawIndirectInternal(*commandBufferResourcePool.Get(frameContext.GetCommandBuffer()),
+                             GetFrameNumberFromFrameContext(frameContext),
+                             false,
+                             argumentBuffer,
+                             offset,
+                             RHIBufferHandle::Null(),
+                             0,
+                             drawCount,
+                             stride);
+    }
+
+    void RHIDeviceVulkan::DrawIndexedIndirect(const RHIFrameContext& frameContext,
+                                              const RHIBufferHandle& argumentBuffer,
+                                              uint64_t offset,
+                                              uint32_t drawCount,
+                                              uint32_t stride) {
+        OZZ_PROFILE_FUNCTION;
+        drawIndirectInternal(*commandBufferResourcePool.Get(frameContext.GetCommandBuffer()),
+                             GetFrameNumberFromFrameContext(frameContext),
+                             true,
+                             argumentBuffer,
+                             offset,
+                             RHIBufferHandle::Null(),
+                             0,
+                             drawCount,
+                             stride);
+    }
+
+    void RHIDeviceVulkan::DrawIndirectCount(const RHIFrameContext& frameContext,
+                                            const RHIBufferHandle& argumentBuffer,
+                                            uint64_t offset,
+                                            const RHIBufferHandle& countBuffer,
+                                            uint64_t countOffset,
+                                            uint32_t maxDrawCount,
+                                            uint32_t stride) {
+        OZZ_PROFILE_FUNCTION;
+        drawIndirectInternal(*commandBufferResourcePool.Get(frameContext.GetCommandBuffer()),
+                             GetFrameNumberFromFrameContext(frameContext),
+                             false,
+                             argumentBuffer,
+                             offset,
+                             countBuffer,
+                             countOffset,
+                             maxDrawCount,
+                             stride);
+    }
+
+    void RHIDeviceVulkan::DrawIndexedIndirectCount(const RHIFrameContext& frameContext,
+                                                   const RHIBufferHandle& argumentBuffer,
+                                                   uint64_t offset,
+                                                   const RHIBufferHandle& countBuffer,
+                                                   uint64_t countOffset,
+                                                   uint32_t maxDrawCount,
+                                                   uint32_t stride) {
+        OZZ_PROFILE_FUNCTION;
+        drawIndirectInternal(*commandBufferResourcePool.Get(frameContext.GetCommandBuffer()),
+                             GetFrameNumberFromFrameContext(frameContext),
+                             true,
+                             argumentBuffer,
+                             offset,
+                             countBuffer,
+                             countOffset,
+                             maxDrawCount,
+                             stride);
+    }
+
+    void RHIDeviceVulkan::drawIndirectInternal(RHICommandBufferVulkan& commandBuffer,
+                                               uint32_t frameIndex,
+                                               bool bIndexed,
+                                               const RHIBufferHandle& argumentBuffer,
+                                               uint64_t offset,
+                                               const RHIBufferHandle& countBuffer,
+                                               uint64_t countOffset,
+                                               uint32_t drawCount,
+                                               uint32_t stride) {
+        const VkCommandBuffer cmd = commandBuffer.CommandBuffer;
+        OZZ_GPU_ZONE(tracyGpuContext, cmd, "DrawIndirect");
+        if (commandBuffer.bParallelRenderPass) {
+            spdlog::error("Draw recorded on the owning context of a parallel render pass; use a forked context");
+            return;
+        }
+        // See drawInternal: log/assert only, never skip the draw on Vulkan.
+        if (!commandBuffer.bStateSetThisPass) {
+            spdlog::error("Draw issued without SetGraphicsState in current render pass");
+#ifdef OZZ_DEBUG
+            assert(false && "Draw without SetGraphicsState in current render pass");
+#endif
+        }
+        if (drawCount == 0) {
+            return;
+        }
+
+        // Copy 0, where arguments written by an earlier dispatch land, except for Stream
+        // buffers, whose recording frame's copy holds the arguments written this frame
+        const auto resolveArguments = [frameIndex](const std::vector<RHIBufferVulkan>& buffers) -> const auto& {
+            return buffers.front().Lifetime == BufferLifetime::Stream ? resolveBuffer(buffers, frameIndex)
+                                                                      : buffers.front();
+        };
+        const auto* arguments = bufferResourcePool.Get(argumentBuffer);
+        if (!arguments || !has(arguments->front().Usage, BufferUsage::Indirect)) {
+            spdlog::error("DrawIndirect: argument buffer is invalid or lacks BufferUsage::Indirect");
+            return;
+        }
+        const VkBuffer argumentsBuffer = resolveArguments(*arguments).Buffer;
+        flushPendingBarriers(commandBuffer);
+
+        if (countBuffer.IsValid() && bDrawIndirectCount) {
+            const auto* counts = bufferResourcePool.Get(countBuffer);
+            if (!counts || !has(counts->front().Usage, BufferUsage::Indirect)) {
+                spdlog::error("DrawIndirectCount: count buffer is invalid or lacks BufferUsage::Indirect");
+                return;
+            }
+            const VkBuffer countsBuffer = resolveArguments(*counts).Buffer;
+            if (bIndexed) {
+                vkCmdDrawIndexedIndirectCount(
+                    cmd, argumentsBuffer, offset, countsBuffer, countOffset, drawCount, stride);
+            } else {
+                vkCmdDrawIndirectCount(cmd, argumentsBuffer, offset, countsBuffer, countOffset, drawCount, stride);
+            }
+            return;
+        }
+
+        // Without drawIndirectCount every entry up to the maximum is drawn (see RHIDevice).
+        // Without multiDrawIndirect each draw is its own call.
+        const uint32_t drawsPerCall = bMultiDrawIndirect ? drawCount : 1;
+        for (uint32_t first = 0; first < drawCount; first += drawsPerCall) {
+            const VkDeviceSize callOffset = offset + static_cast<VkDeviceSize>(first) * stride;
+            if (bIndexed) {
+                vkCmdDrawIndexedIndirect(cmd, argumentsBuffer, callOffset, drawsPerCall, stride);
+            } else {
+                vkCmdDrawIndirect(cmd, argumentsBuffer, callOffset, drawsPerCall, stride);
+            }
+        }
+    }
+
+    // ============================================================
+    // === Command Buffer Recording - Compute ===
+    // ============================================================
+
+    void RHIDeviceVulkan::Dispatch(const RHIFrameContext& frameContext,
+                                   uint32_t groupCountX,
+                                   uint32_t groupCountY,
+                                   uint32_t groupCountZ) {
+        OZZ_PROFILE_FUNCTION;
+        dispatchInternal(*commandBufferResourcePool.Get(frameContext.GetCommandBuffer()),
+                         groupCountX,
+                         groupCountY,
+                         groupCountZ);
+    }
+
+    void RHIDeviceVulkan::dispatchInternal(RHICommandBufferVulkan& commandBuffer,
+                                           uint32_t groupCountX,
+                                           uint32_t groupCountY,
+                                           uint32_t groupCountZ) {
+        const VkCommandBuffer cmd = commandBuffer.CommandBuffer;
+        OZZ_GPU_ZONE(profilingContext(commandBuffer), cmd, "Dispatch");
+        // vkCmdDispatch inside dynamic rendering is invalid usage.
+        if (commandBuffer.bInRenderPass) {
+            spdlog::error("Dispatch recorded inside a render pass; end the pass first");
+            return;
+        }
+        flushPendingBarriers(commandBuffer);
+        vkCmdDispatch(cmd, groupCountX, groupCountY, groupCountZ);
+    }
+
+    void RHIDeviceVulkan::DispatchIndirect(const RHIFrameContext& frameContext,
+                                           const RHIBufferHandle& bufferHandle,
+                                           uint64_t offset) {
+        OZZ_PROFILE_FUNCTION;
+        dispatchIndirectInternal(*commandBufferResourcePool.Get(frameContext.GetCommandBuffer()),
+                                 GetFrameNumberFromFrameContext(frameContext),
+                                 bufferHandle,
+                                 offset);
+    }
+
+    void RHIDeviceVulkan::dispatchIndirectInternal(RHICommandBufferVulkan& commandBuffer,
+                                                   uint32_t frameIndex,
+                                                   const RHIBufferHandle& bufferHandle,
+                                                   uint64_t offset) {
+        const VkCommandBuffer cmd = commandBuffer.CommandBuffer;
+        OZZ_GPU_ZONE(profilingContext(commandBuffer), cmd, "DispatchIndirect");
+        if (commandBuffer.bInRenderPass) {
+            spdlog::error("DispatchIndirect recorded inside a render pass; end the pass first");
+            return;
+        }
+        const auto* buffers = bufferResourcePool.Get(bufferHandle);
+        if (!buffers) {
+            spdlog::error("DispatchIndirect: invalid buffer handle");
+            return;
+        }
+        // Copy 0, where arguments written by an earlier dispatch land, except for Stream buffers,
+        // whose recording frame's copy holds the arguments written this frame (as in DrawIndirect)
+        const auto& buffer = buffers->front().Lifetime == BufferLifetime::Stream ? resolveBuffer(*buffers, frameIndex)
+                                                                                 : buffers->front();
+        if (!has(buffer.Usage, BufferUsage::Indirect)) {
+            spdlog::error("DispatchIndirect: buffer was not created with BufferUsage::Indirect");
+            return;
+        }
+        flushPendingBarriers(commandBuffer);
+        vkCmdDispatchIndirect(cmd, buffer.Buffer, offset);
+    }
+
     // ============================================================
     // === Descriptor Sets ===
     // ============================================================
@@ -1628,24 +3365,27 @@ namespace OZZ::rendering::vk {
             return RHIDescriptorSetHandle::Null();
         }
 
-        VkDescriptorSetAllocateInfo allocInfo {
-            .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
-            .descriptorPool = descriptorPool,
-            .descriptorSetCount = 1,
-            .pSetLayouts = layout,
-        };
-
-        VkDescriptorSet set {VK_NULL_HANDLE};
-        {
-            // Pool alloc requires external synchronization on the shared descriptorPool.
-            std::lock_guard lock(descriptorPoolMutex);
-            if (const auto result = vkAllocateDescriptorSets(device, &allocInfo, &set); result != VK_SUCCESS) {
-                spdlog::error("Failed to allocate descriptor set. Error: {}", static_cast<int>(result));
-                return RHIDescriptorSetHandle::Null();
-            }
+        auto set =
+            layout->bDescriptorBuffer ? allocateDescriptorBufferSet(*layout) : descriptorAllocator.Allocate(*layout);
+        if (!set) {
+            return RHIDescriptorSetHandle::Null();
         }
+        return descriptorSetResourcePool.Allocate(std::move(*set));
+    }
 
-        return descriptorSetResourcePool.Allocate(std::move(set));
+    std::optional<RHIDescriptorSetVulkan>
+    RHIDeviceVulkan::allocateDescriptorBufferSet(const RHIDescriptorSetLayoutVulkan& layout) {
+        const auto range = descriptorBuffer.Allocate(layout.Size);
+        if (!range) {
+            return std::nullopt;
+        }
+        return RHIDescriptorSetVulkan {
+            .BufferAllocation = range->Allocation,
+            .BufferIndex = range->Buffer,
+            .BufferOffset = range->Offset,
+            .BufferSize = layout.Size,
+            .BindingOffsets = layout.BindingOffsets,
+        };
     }
 
     void RHIDeviceVulkan::UpdateDescriptorSet(RHIDescriptorSetHandle handle,
@@ -1656,6 +3396,10 @@ namespace OZZ::rendering::vk {
             spdlog::error("UpdateDescriptorSet: invalid descriptor set handle");
             return;
         }
+        if (set->BufferAllocation != VK_NULL_HANDLE) {
+            updateDescriptorBufferSet(*set, writes);
+            return;
+        }
 
         std::vector<VkWriteDescriptorSet> vkWrites;
         vkWrites.reserve(writes.size() * 2); // *2 for SampledImage auto-write sampler
@@ -1670,7 +3414,7 @@ namespace OZZ::rendering::vk {
         for (const auto& write : writes) {
             VkWriteDescriptorSet vkWrite {
                 .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
-                .dstSet = *set,
+                .dstSet = set->Set,
                 .dstBinding = write.Binding,
                 .dstArrayElement = 0,
                 .descriptorCount = 1,
@@ -1678,14 +3422,27 @@ namespace OZZ::rendering::vk {
             };
 
             if (write.Type == DescriptorType::UniformBuffer || write.Type == DescriptorType::StorageBuffer ||
-                write.Type == DescriptorType::ReadOnlyStorageBuffer) {
+                write.Type == DescriptorType::ReadOnlyStorageBuffer ||
+                write.Type == DescriptorType::UniformBufferDynamic ||
+                write.Type == DescriptorType::StorageBufferDynamic) {
                 const auto* buffers = bufferResourcePool.Get(write.Buffer.Buffer);
                 if (!buffers) {
                     spdlog::error("UpdateDescriptorSet: invalid buffer handle at binding {}", write.Binding);
                     continue;
                 }
+                // Copy 0, where GPU writes through earlier bindings land, except for Stream
+                // buffers: only the recording frame's copy holds this frame's data, so only
+                // transient sets, which live for that frame alone, may reference one
+                if (buffers->front().Lifetime == BufferLifetime::Stream && !set->bTransient) {
+                    spdlog::error("UpdateDescriptorSet: Stream buffer at binding {} needs a transient descriptor set",
+                                  write.Binding);
+                    continue;
+                }
+                const auto& buffer = buffers->front().Lifetime == BufferLifetime::Stream
+                                         ? resolveBuffer(*buffers, set->FrameIndex)
+                                         : buffers->front();
                 bufferInfos.push_back({
-                    .buffer = (*buffers)[0].Buffer,
+                    .buffer = buffer.Buffer,
                     .offset = write.Buffer.Offset,
                     .range = write.Buffer.Range,
                 });
@@ -1717,30 +3474,154 @@ namespace OZZ::rendering::vk {
                     samplerWrite.pImageInfo = &imageInfos.back();
                     vkWrites.push_back(samplerWrite);
                 }
+            } else if (write.Type == DescriptorType::StorageImage) {
+                // Read-write image access from compute: no sampler, and the image must be in
+                // TextureLayout::General when the dispatch runs.
+                const auto* texture = texturePool.Get(write.Image.Texture);
+                if (!texture) {
+                    spdlog::error("UpdateDescriptorSet: invalid texture handle at binding {}", write.Binding);
+                    continue;
+                }
+                imageInfos.push_back({
+                    .sampler = VK_NULL_HANDLE,
+                    .imageView = texture->ImageView,
+                    .imageLayout = ConvertTextureLayoutToVulkan(TextureLayout::General),
+                });
+                vkWrite.pImageInfo = &imageInfos.back();
+                vkWrites.push_back(vkWrite);
+            } else {
+                const auto* texture = texturePool.Get(write.Image.Texture);
+                if (!texture) {
+                    spdlog::error("UpdateDescriptorSet: invalid texture handle at binding {}", write.Binding);
+                    continue;
+                }
+                imageInfos.push_back({
+                    .sampler = texture->Sampler,
+                    .imageView = texture->ImageView,
+                    .imageLayout = ConvertTextureLayoutToVulkan(TextureLayout::ShaderReadOnly),
+                });
+                vkWrite.pImageInfo = &imageInfos.back();
+                vkWrites.push_back(vkWrite);
+            }
+        }
+
+        // The real hazard is update-vs-free of the SAME descriptor set (per Vulkan spec,
+        // the set being written must be externally synchronized against its free). We
+        // serialize on the mutex of the set's pool, which its free takes too.
+        {
+            std::lock_guard lock(set->Pool->Mutex);
+            vkUpdateDescriptorSets(device, static_cast<uint32_t>(vkWrites.size()), vkWrites.data(), 0, nullptr);
+        }
+    }
+
+    void RHIDeviceVulkan::updateDescriptorBufferSet(const RHIDescriptorSetVulkan& set,
+                                                    std::span<const RHIDescriptorWrite> writes) {
+        const auto bindingOffset = [&set](const uint32_t binding) {
+            return binding < set.BindingOffsets.size() ? set.BindingOffsets[binding] : InvalidBindingOffset;
+        };
+        const auto writeDescriptor = [&](const uint32_t binding, const VkDescriptorGetInfoEXT& info) {
+            const auto offset = bindingOffset(binding);
+            if (offset == InvalidBindingOffset) {
+                spdlog::error("UpdateDescriptorSet: the set layout has no binding {}", binding);
+                return;
+            }
+            descriptorBuffer.Write(set.BufferIndex, set.BufferOffset + offset, info);
+        };
+
+        // Mirrors the vkUpdateDescriptorSets path above, except that each descriptor is written
+        // straight into the set's range of the mapped descriptor buffer
+        for (const auto& write : writes) {
+            VkDescriptorGetInfoEXT info {
+                .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT,
+                .pNext = nullptr,
+                .type = ConvertDescriptorTypeToVulkan(write.Type),
+                .data = {},
+            };
+
+            if (write.Type == DescriptorType::UniformBufferDynamic ||
+                write.Type == DescriptorType::StorageBufferDynamic) {
+                // Layouts with dynamic bindings are never created for the descriptor buffer
+                spdlog::error("UpdateDescriptorSet: dynamic descriptor at binding {} in a descriptor buffer set",
+                              write.Binding);
+            } else if (write.Type == DescriptorType::UniformBuffer || write.Type == DescriptorType::StorageBuffer ||
+                       write.Type == DescriptorType::ReadOnlyStorageBuffer) {
+                const auto* buffers = bufferResourcePool.Get(write.Buffer.Buffer);
+                if (!buffers) {
+                    spdlog::error("UpdateDescriptorSet: invalid buffer handle at binding {}", write.Binding);
+                    continue;
+                }
+                // Same copy selection as the vkUpdateDescriptorSets path
+                if (buffers->front().Lifetime == BufferLifetime::Stream && !set.bTransient) {
+                    spdlog::error("UpdateDescriptorSet: Stream buffer at binding {} needs a transient descriptor set",
+                                  write.Binding);
+                    continue;
+                }
+                const auto& buffer = buffers->front().Lifetime == BufferLifetime::Stream
+                                         ? resolveBuffer(*buffers, set.FrameIndex)
+                                         : buffers->front();
+                // Descriptors hold an address and an explicit range, so resolve VK_WHOLE_SIZE here
+                const VkDescriptorAddressInfoEXT addressInfo {
+                    .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT,
+                    .pNext = nullptr,
+                    .address = buffer.DeviceAddress + write.Buffer.Offset,
+                    .range = write.Buffer.Range == VK_WHOLE_SIZE ? buffer.Size - write.Buffer.Offset
+                                                                 : write.Buffer.Range,
+                    .format = VK_FORMAT_UNDEFINED,
+                };
+                if (write.Type == DescriptorType::UniformBuffer) {
+                    info.data.pUniformBuffer = &addressInfo;
+                } else {
+                    info.data.pStorageBuffer = &addressInfo;
+                }
+                writeDescriptor(write.Binding, info);
+            } else if (write.Type == DescriptorType::SampledImage) {
+                const auto* texture = texturePool.Get(write.Image.Texture);
+                if (!texture) {
+                    spdlog::error("UpdateDescriptorSet: invalid texture handle at binding {}", write.Binding);
+                    continue;
+                }
+                const VkDescriptorImageInfo imageInfo {
+                    .sampler = VK_NULL_HANDLE,
+                    .imageView = texture->ImageView,
+                    .imageLayout = ConvertTextureLayoutToVulkan(TextureLayout::ShaderReadOnly),
+                };
+                info.data.pSampledImage = &imageInfo;
+                writeDescriptor(write.Binding, info);
+                // auto-write sampler at binding+1, like the vkUpdateDescriptorSets path
+                if (texture->Sampler != VK_NULL_HANDLE) {
+                    const VkDescriptorGetInfoEXT samplerInfo {
+                        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT,
+                        .pNext = nullptr,
+                        .type = VK_DESCRIPTOR_TYPE_SAMPLER,
+                        .data = {.pSampler = &texture->Sampler},
+                    };
+                    writeDescriptor(write.Binding + 1, samplerInfo);
+                }
             } else {
                 const auto* texture = texturePool.Get(write.Image.Texture);
                 if (!texture) {
                     spdlog::error("UpdateDescriptorSet: invalid texture handle at binding {}", write.Binding);
                     continue;
                 }
-                imageInfos.push_back({
-                    .sampler = texture->Sampler,
+                const bool bStorage = write.Type == DescriptorType::StorageImage;
+                const VkDescriptorImageInfo imageInfo {
+                    .sampler = bStorage ? VK_NULL_HANDLE : texture->Sampler,
                     .imageView = texture->ImageView,
-                    .imageLayout = ConvertTextureLayoutToVulkan(TextureLayout::ShaderReadOnly),
-                });
-                vkWrite.pImageInfo = &imageInfos.back();
-                vkWrites.push_back(vkWrite);
+                    .imageLayout = ConvertTextureLayoutToVulkan(bStorage ? TextureLayout::General
+                                                                         : TextureLayout::ShaderReadOnly),
+                };
+                if (write.Type == DescriptorType::Sampler) {
+                    info.data.pSampler = &texture->Sampler;
+                } else if (bStorage) {
+                    info.data.pStorageImage = &imageInfo;
+                } else {
+                    info.data.pCombinedImageSampler = &imageInfo;
+                }
+                writeDescriptor(write.Binding, info);
             }
         }
 
-        // The real hazard is update-vs-free of the SAME descriptor set (per Vulkan spec,
-        // the set being written must be externally synchronized against its free). We
-        // serialize on descriptorPoolMutex — coarser than strictly required, but cheap
-        // and correct.
-        {
-            std::lock_guard lock(descriptorPoolMutex);
-            vkUpdateDescriptorSets(device, static_cast<uint32_t>(vkWrites.size()), vkWrites.data(), 0, nullptr);
-        }
+        descriptorBuffer.Flush(set.BufferIndex, set.BufferOffset, set.BufferSize);
     }
 
     void RHIDeviceVulkan::FreeDescriptorSet(RHIDescriptorSetHandle handle) {
@@ -1750,6 +3631,31 @@ namespace OZZ::rendering::vk {
         });
     }
 
+    RHIDescriptorSetHandle RHIDeviceVulkan::AllocateTransientDescriptorSet(const RHIFrameContext& frameContext,
+                                                                           RHIDescriptorSetLayoutHandle layoutHandle) {
+        OZZ_PROFILE_FUNCTION;
+        const auto* layout = descriptorSetLayoutResourcePool.Get(layoutHandle);
+        if (!layout) {
+            spdlog::error("AllocateTransientDescriptorSet: invalid descriptor set layout handle");
+            return RHIDescriptorSetHandle::Null();
+        }
+
+        const uint32_t frameIndex = GetFrameNumberFromFrameContext(frameContext);
+        auto& submissionContext = submissionContexts[frameIndex];
+        std::lock_guard lock(transientMutex);
+        // Descriptor buffer sets have no arena to reset; BeginFrame frees them with the handles
+        auto set = layout->bDescriptorBuffer ? allocateDescriptorBufferSet(*layout)
+                                             : submissionContext.TransientDescriptors.Allocate(device, *layout);
+        if (!set) {
+            return RHIDescriptorSetHandle::Null();
+        }
+        set->bTransient = true;
+        set->FrameIndex = frameIndex;
+        const auto handle = descriptorSetResourcePool.Allocate(std::move(*set));
+        submissionContext.TransientDescriptorSets.push_back(handle);
+        return handle;
+    }
+
     // ============================================================
     // === Resource Creation ===
     // ============================================================
@@ -1759,12 +3665,40 @@ namespace OZZ::rendering::vk {
     // vkCreateShadersEXT, and buffer/image creation via VMA) are thread-safe per the
     // Vulkan spec — they do not mutate externally-visible shared state and require no
     // external synchronization, so they are deliberately left unguarded. VMA itself is
-    // internally synchronized (VmaAllocatorCreateInfo.flags = 0). The only shared object
-    // requiring external synchronization on these paths is the single VkDescriptorPool,
-    // guarded by descriptorPoolMutex (see CreateDescriptorSet / UpdateDescriptorSet and
-    // the descriptorSetResourcePool free lambda).
+    // internally synchronized (no VMA_ALLOCATOR_CREATE_EXTERNALLY_SYNCHRONIZED_BIT). The only
+    // shared objects requiring external synchronization on these paths are the descriptor
+    // pools, each guarded by its own mutex inside DescriptorAllocatorVulkan (see
+    // CreateDescriptorSet / UpdateDescriptorSet and the descriptorSetResourcePool free lambda),
+    // and the descriptor buffer's virtual block, guarded inside DescriptorBufferVulkan.
     RHITextureHandle RHIDeviceVulkan::CreateTexture(TextureDescriptor&& descriptor) {
         OZZ_PROFILE_FUNCTION;
+        // Transient attachments may only carry attachment usages, so they can not be uploaded to
+        const bool bTransient = has(descriptor.Usage, TextureUsage::Transient);
+        if (bTransient && has(descriptor.Usage,
+                              TextureUsage::Sampled | TextureUsage::Storage | TextureUsage::TransferSrc |
+                                  TextureUsage::TransferDst)) {
+            spdlog::error("Failed to create texture. Transient textures can only be color or depth attachments.");
+            return RHITextureHandle::Null();
+        }
+
+        const auto samples = ConvertSampleCountToVulkan(descriptor.Samples);
+        if (samples != VK_SAMPLE_COUNT_1_BIT) {
+            const auto& limits = physicalDevices.SelectedDevice().Properties.properties.limits;
+            const bool bDepth = has(descriptor.Usage, TextureUsage::DepthAttachment);
+            const VkSampleCountFlags supportedSamples =
+                bDepth ? limits.framebufferDepthSampleCounts & limits.framebufferStencilSampleCounts
+                       : limits.framebufferColorSampleCounts;
+            if (!bDepth && !has(descriptor.Usage, TextureUsage::ColorAttachment)) {
+                spdlog::error("Failed to create texture. Multisampled textures must be color or depth attachments.");
+                return RHITextureHandle::Null();
+            }
+            if (has(descriptor.Usage, TextureUsage::Storage) || (supportedSamples & samples) == 0) {
+                spdlog::error("Failed to create texture. {} samples are not supported for this usage.",
+                              static_cast<int>(descriptor.Samples));
+                return RHITextureHandle::Null();
+            }
+        }
+
         VkImageCreateInfo imageCreateInfo {
             .sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
             .pNext = nullptr,
@@ -1779,24 +3713,31 @@ namespace OZZ::rendering::vk {
                 },
             .mipLevels = 1,
             .arrayLayers = 1,
-            .samples = VK_SAMPLE_COUNT_1_BIT,
+            .samples = samples,
             .tiling = VK_IMAGE_TILING_OPTIMAL,
-            .usage = ConvertTextureUsageToVulkan(descriptor.Usage |
-                                                 TextureUsage::TransferDst), // Ensure we can copy data to the texture
+            // Ensure we can copy data to the texture
+            .usage = ConvertTextureUsageToVulkan(bTransient ? descriptor.Usage
+                                                            : descriptor.Usage | TextureUsage::TransferDst),
             .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
             .queueFamilyIndexCount = 0,
             .pQueueFamilyIndices = nullptr,
             .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
         };
 
+        // Lazily allocated memory is only committed if the attachment has to be written out, which
+        // tilers avoid for attachments cleared and discarded within a render pass
         VmaAllocationCreateInfo allocationCreateInfo {
             .flags = 0,
-            .usage = VMA_MEMORY_USAGE_GPU_ONLY,
+            .usage = bTransient && bLazilyAllocatedMemory ? VMA_MEMORY_USAGE_GPU_LAZILY_ALLOCATED
+                                                          : VMA_MEMORY_USAGE_GPU_ONLY,
         };
 
         RHITextureVulkan texture {
             .Width = descriptor.Width,
             .Height = descriptor.Height,
+            .Format = ConvertTextureFormatToVulkan(descriptor.Format),
+            .Samples = samples,
+            .bTransient = bTransient,
         };
         if (auto result = vmaCreateImage(vmaAllocator,
                                          &imageCreateInfo,
@@ -1875,9 +3816,15 @@ namespace OZZ::rendering::vk {
             }
         }
 
+        // The bindless arrays hold single-sampled images only
+        if (has(descriptor.Usage, TextureUsage::Sampled) && samples == VK_SAMPLE_COUNT_1_BIT) {
+            texture.BindlessIndex = bindlessHeap.AddTexture(texture.ImageView, texture.Sampler);
+        }
+
         const auto handle = texturePool.Allocate(std::move(texture));
         if (has(descriptor.Usage, TextureUsage::DepthAttachment)) {
-            const auto immediateCmd = beginSingleTimeCommands();
+            // Layout transition only, no copy: stays on the queue that will use the attachment
+            const auto immediateCmd = beginSingleTimeCommands(graphicsQueue);
             textureResourceBarrierInternal(immediateCmd,
                                            TextureBarrierDescriptor {
                                                .Texture = handle,
@@ -1896,31 +3843,61 @@ namespace OZZ::rendering::vk {
                                                        .LayerCount = 1,
                                                    },
                                            });
-            endSingleTimeCommands(immediateCmd);
+            endSingleTimeCommands(graphicsQueue, immediateCmd);
         }
         return handle;
     }
 
     void RHIDeviceVulkan::UpdateTexture(const RHITextureHandle& handle, const void* data, size_t size) {
         OZZ_PROFILE_FUNCTION;
-        // Create a staging buffer
-        auto stagingBufferHandle =
-            CreateBuffer({.Size = size, .Usage = BufferUsage::TransferSource, .Access = BufferMemoryAccess::CpuToGpu});
-
-        // Map the staging buffer and copy the data
-        const auto* stagingBuffer = bufferResourcePool.Get(stagingBufferHandle);
-        if (!stagingBuffer) {
-            spdlog::error("Failed to get staging buffer for texture update. Handle is invalid.");
-            return;
+        // The only host wait, on the graphics timeline: with a transfer queue, the batch's
+        // graphics submission waits for the copies on the GPU (see submitUploadBatchLocked)
+        WaitForUpload(UpdateTextureAsync(handle, data, size), UINT64_MAX);
+    }
+
+    UploadTicket RHIDeviceVulkan::UpdateTextureAsync(const RHITextureHandle& handle, const void* data, size_t size) {
+        OZZ_PROFILE_FUNCTION;
+        const auto* texture = texturePool.Get(handle);
+        if (!texture) {
+            spdlog::error("Failed to update texture. Texture handle is invalid.");
+            return {};
+        }
+        if (size == 0) {
+            spdlog::error("Failed to update texture. No data given.");
+            return {};
+        }
+        if (texture->bTransient || texture->Samples != VK_SAMPLE_COUNT_1_BIT) {
+            spdlog::error("Failed to update texture. Transient and multisampled textures can not be uploaded to.");
+            return {};
+        }
+
+        // Record the copy into the open batch; it is submitted with the rest of the batch
+        auto& queue = uploadQueue();
+        const bool bOwnershipTransfer = queue.Family != graphicsQueue.Family;
+
+        std::lock_guard lock(uploadMutex);
+        auto& batch = openUploadBatch;
+        if (batch.GraphicsCommands == VK_NULL_HANDLE) {
+            batch.GraphicsCommands = beginSingleTimeCommands(graphicsQueue);
+        }
+        if (bOwnershipTransfer && batch.TransferCommands == VK_NULL_HANDLE) {
+            batch.TransferCommands = beginSingleTimeCommands(queue);
+        }
+        if (batch.GraphicsCommands == VK_NULL_HANDLE ||
+            (bOwnershipTransfer && batch.TransferCommands == VK_NULL_HANDLE)) {
+            return {};
+        }
+
+        // Copy offsets must be a multiple of both the texel size and 4
+        const auto alignment = std::lcm(GetTexelSize(texture->Format), VkDeviceSize {4});
+        const auto staged = stageUploadLocked(batch, data, size, alignment);
+        if (!staged) {
+            return {};
         }
-        void* mapped = (*stagingBuffer)[0].AllocationInfo.pMappedData;
-        memcpy(mapped, data, size);
-        // copy from staging buffer to texture using a command buffer and appropriate barriers
-        auto immediateCmd = beginSingleTimeCommands();
+        const VkCommandBuffer copyCmd = bOwnershipTransfer ? batch.TransferCommands : batch.GraphicsCommands;
 
-        auto texture = texturePool.Get(handle);
         VkBufferImageCopy region {};
-        region.bufferOffset = 0;
+        region.bufferOffset = staged->Offset;
         region.bufferRowLength = 0;
         region.bufferImageHeight = 0;
 
@@ -1931,35 +3908,319 @@ namespace OZZ::rendering::vk {
 
         region.imageOffset = {0, 0, 0};
         region.imageExtent = {texture->Width, texture->Height, 1};
-        textureResourceBarrierInternal(immediateCmd,
-                                       TextureBarrierDescriptor {
-                                           .Texture = handle,
-                                           .OldLayout = TextureLayout::Undefined,
-                                           .NewLayout = TextureLayout::TransferDst,
-                                           .SrcStage = PipelineStage::None,
-                                           .DstStage = PipelineStage::Transfer,
-                                           .SrcAccess = Access::None,
-                                           .DstAccess = Access::TransferWrite,
-                                       });
-        vkCmdCopyBufferToImage(immediateCmd,
-                               (*stagingBuffer)[0].Buffer,
-                               texturePool.Get(handle)->Image,
+
+        // A texture that has already been uploaded keeps its contents through the transition.
+        // Only the sampled layout is trusted: the batch runs ahead of the frame being recorded,
+        // whose transitions the tracked state may already include. Across queue families the
+        // contents are not preserved without an ownership transfer, so those start from Undefined.
+        TextureLayout uploadOldLayout = TextureLayout::Undefined;
+        UploadTextureState uploadState {.Texture = handle};
+        {
+            std::lock_guard stateLock(textureStateMutex);
+            if (!bOwnershipTransfer &&
+                texture->SubresourceStates.front().Layout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) {
+                uploadOldLayout = TextureLayout::ShaderReadOnly;
+            }
+            uploadState.RecordedLayouts.reserve(texture->SubresourceStates.size());
+            for (const auto& state : texture->SubresourceStates) {
+                uploadState.RecordedLayouts.push_back(state.Layout);
+            }
+        }
+
+        // The tracked state belongs to the frames being recorded until the batch is submitted,
+        // so these barriers leave it alone; submitUploadBatchLocked applies the final one
+        const auto recordUploadBarrier = [&](VkCommandBuffer cmd, const TextureBarrierDescriptor& barrierDescriptor) {
+            const auto barrier = convertTextureBarrier(barrierDescriptor);
+            if (barrier) {
+                recordTextureBarrierInternal(cmd, *barrier);
+            }
+            return barrier;
+        };
+        recordUploadBarrier(copyCmd,
+                            TextureBarrierDescriptor {
+                                .Texture = handle,
+                                .OldLayout = uploadOldLayout,
+                                .NewLayout = TextureLayout::TransferDst,
+                                .SrcStage = PipelineStage::None,
+                                .DstStage = PipelineStage::Transfer,
+                                .SrcAccess = Access::None,
+                                .DstAccess = Access::TransferWrite,
+                            });
+        vkCmdCopyBufferToImage(copyCmd,
+                               staged->Buffer,
+                               texture->Image,
                                VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
                                1,
                                &region);
-        textureResourceBarrierInternal(immediateCmd,
-                                       TextureBarrierDescriptor {
-                                           .Texture = handle,
-                                           .OldLayout = TextureLayout::TransferDst,
-                                           .NewLayout = TextureLayout::ShaderReadOnly,
-                                           .SrcStage = PipelineStage::Transfer,
-                                           .DstStage = PipelineStage::FragmentShader,
-                                           .SrcAccess = Access::TransferWrite,
-                                           .DstAccess = Access::ShaderRead,
-                                       });
-        endSingleTimeCommands(immediateCmd);
 
-        bufferResourcePool.Free(stagingBufferHandle);
+        // The final barrier waits for the copy in every later command on the graphics queue,
+        // which is what makes the texture usable by work submitted after the batch.
+        std::optional<VkImageMemoryBarrier2> finalBarrier;
+        if (!bOwnershipTransfer) {
+            finalBarrier = recordUploadBarrier(copyCmd,
+                                               TextureBarrierDescriptor {
+                                                   .Texture = handle,
+                                                   .OldLayout = TextureLayout::TransferDst,
+                                                   .NewLayout = TextureLayout::ShaderReadOnly,
+                                                   .SrcStage = PipelineStage::Transfer,
+                                                   .DstStage = PipelineStage::AllCommands,
+                                                   .SrcAccess = Access::TransferWrite,
+                                                   .DstAccess = Access::ShaderRead,
+                                               });
+        } else {
+            // Queue family ownership transfer: release on the transfer queue, acquire on the
+            // graphics queue. Both halves carry the same layout transition; the destination
+            // scope of the release and the source scope of the acquire are ignored.
+            recordUploadBarrier(copyCmd,
+                                TextureBarrierDescriptor {
+                                    .Texture = handle,
+                                    .OldLayout = TextureLayout::TransferDst,
+                                    .NewLayout = TextureLayout::ShaderReadOnly,
+                                    .SrcStage = PipelineStage::Transfer,
+                                    .DstStage = PipelineStage::None,
+                                    .SrcAccess = Access::TransferWrite,
+                                    .DstAccess = Access::None,
+                                    .SrcQueueFamily = queue.Family,
+                                    .DstQueueFamily = graphicsQueue.Family,
+                                });
+            finalBarrier = recordUploadBarrier(batch.GraphicsCommands,
+                                               TextureBarrierDescriptor {
+                                                   .Texture = handle,
+                                                   .OldLayout = TextureLayout::TransferDst,
+                                                   .NewLayout = TextureLayout::ShaderReadOnly,
+                                                   .SrcStage = PipelineStage::None,
+                                                   .DstStage = PipelineStage::AllCommands,
+                                                   .SrcAccess = Access::None,
+                                                   .DstAccess = Access::ShaderRead,
+                                                   .SrcQueueFamily = queue.Family,
+                                                   .DstQueueFamily = graphicsQueue.Family,
+                                               });
+        }
+        if (finalBarrier) {
+            uploadState.Barrier = *finalBarrier;
+            batch.TextureStates.push_back(std::move(uploadState));
+        }
+
+        return {.Value = batch.Id};
+    }
+
+    UploadTicket RHIDeviceVulkan::SubmitUploads() {
+        OZZ_PROFILE_FUNCTION;
+        std::lock_guard lock(uploadMutex);
+        submitUploadBatchLocked();
+        retireUploadBatchesLocked();
+        return {.Value = openUploadBatch.Id - 1};
+    }
+
+    bool RHIDeviceVulkan::IsUploadComplete(const UploadTicket& ticket) {
+        std::lock_guard lock(uploadMutex);
+        retireUploadBatchesLocked();
+        return ticket.Value <= completedUploadBatch;
+    }
+
+    bool RHIDeviceVulkan::WaitForUpload(const UploadTicket& ticket, const uint64_t timeoutNs) {
+        OZZ_PROFILE_FUNCTION;
+        uint64_t timelineValue = 0;
+        {
+            std::lock_guard lock(uploadMutex);
+            if (ticket.Value > openUploadBatch.Id) {
+                spdlog::error("WaitForUpload given unknown upload ticket {}", ticket.Value);
+                return false;
+            }
+            if (ticket.Value == openUploadBatch.Id) {
+                submitUploadBatchLocked();
+            }
+            retireUploadBatchesLocked();
+            if (ticket.Value <= completedUploadBatch) {
+                return true;
+            }
+            for (const auto& batch : submittedUploadBatches) {
+                if (batch.Id == ticket.Value) {
+                    timelineValue = batch.TimelineValue;
+                    break;
+                }
+            }
+        }
+
+        // Wait without the lock so other threads can keep recording uploads
+        if (!waitForQueueValue(graphicsQueue, timelineValue, timeoutNs)) {
+            return false;
+        }
+        std::lock_guard lock(uploadMutex);
+        retireUploadBatchesLocked();
+        return true;
+    }
+
+    void RHIDeviceVulkan::submitUploadBatchLocked() {
+        auto& batch = openUploadBatch;
+        if (batch.GraphicsCommands == VK_NULL_HANDLE) {
+            return;
+        }
+
+        auto& queue = uploadQueue();
+        uint64_t transferValue = 0;
+        bool bTransferSubmitted = true;
+        if (batch.TransferCommands != VK_NULL_HANDLE) {
+            if (const auto result = vkEndCommandBuffer(batch.TransferCommands); result == VK_SUCCESS) {
+                transferValue = submitCommandBuffer(queue, batch.TransferCommands);
+            } else {
+                spdlog::error("Failed to end upload transfer command buffer. Error: {}", static_cast<int>(result));
+            }
+            bTransferSubmitted = transferValue != 0;
+        }
+
+        if (bTransferSubmitted) {
+            if (const auto result = vkEndCommandBuffer(batch.GraphicsCommands); result == VK_SUCCESS) {
+                // The acquires must not run before the copies they take ownership of
+                const VkSemaphoreSubmitInfo transferWait {
+                    .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+                    .pNext = nullptr,
+                    .semaphore = queue.Timeline,
+                    .value = transferValue,
+                    .stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+                    .deviceIndex = 0,
+                };
+                batch.TimelineValue = submitCommandBuffer(
+                    graphicsQueue,
+                    batch.GraphicsCommands,
+                    transferValue != 0 ? std::span {&transferWait, 1} : std::span<const VkSemaphoreSubmitInfo> {});
+            } else {
+                spdlog::error("Failed to end upload command buffer. Error: {}", static_cast<int>(result));
+            }
+        }
+
+        if (batch.TimelineValue != 0) {
+            applyUploadTextureStates(batch);
+        } else {
+            spdlog::error("Failed to submit upload batch {}; its textures were not updated", batch.Id);
+            // Whatever reached the transfer queue must finish before its staging memory goes
+            // away. Retiring with the graphics queue's current value keeps batches in order.
+            waitForQueueValue(queue, transferValue, UINT64_MAX);
+            batch.TimelineValue = graphicsQueue.SubmittedValue.load();
+        }
+
+        const auto nextId = batch.Id + 1;
+        submittedUploadBatches.push_back(std::move(batch));
+        openUploadBatch = UploadBatch {.Id = nextId};
+    }
+
+    void RHIDeviceVulkan::applyUploadTextureStates(const UploadBatch& batch) {
+        std::lock_guard lock(textureStateMutex);
+        for (const auto& uploadState : batch.TextureStates) {
+            auto* texture = texturePool.Get(uploadState.Texture);
+            if (!texture || texture->SubresourceStates.size() != uploadState.RecordedLayouts.size()) {
+                continue;
+            }
+            // The batch runs ahead of every frame submitted from now on. A subresource whose
+            // layout changed since the copy was recorded was transitioned by a frame, which runs
+            // later and so decides its state; an earlier upload in this batch counts as unchanged.
+            const auto& barrier = uploadState.Barrier;
+            for (size_t i = 0; i < texture->SubresourceStates.size(); ++i) {
+                auto& current = texture->SubresourceStates[i];
+                if (current.Layout != uploadState.RecordedLayouts[i] && current.Layout != barrier.newLayout) {
+                    continue;
+                }
+                current = {
+                    .Layout = barrier.newLayout,
+                    .Stages = barrier.dstStageMask,
+                    .Access = barrier.dstAccessMask,
+                };
+            }
+        }
+    }
+
+    void RHIDeviceVulkan::retireUploadBatchesLocked() {
+        if (submittedUploadBatches.empty()) {
+            return;
+        }
+
+        const auto completedValue = GetCompletedGpuValue();
+        while (!submittedUploadBatches.empty() && submittedUploadBatches.front().TimelineValue <= completedValue) {
+            auto& batch = submittedUploadBatches.front();
+            releaseUploadBatch(batch);
+            completedUploadBatch = batch.Id;
+            submittedUploadBatches.pop_front();
+        }
+        stagingRing.Retire(completedUploadBatch);
+    }
+
+    void RHIDeviceVulkan::releaseUploadBatch(UploadBatch& batch) {
+        // Only recorded when uploads run on the dedicated transfer queue
+        if (batch.TransferCommands != VK_NULL_HANDLE) {
+            freeSingleTimeCommands(transferQueue, batch.TransferCommands);
+            batch.TransferCommands = VK_NULL_HANDLE;
+        }
+        if (batch.GraphicsCommands != VK_NULL_HANDLE) {
+            freeSingleTimeCommands(graphicsQueue, batch.GraphicsCommands);
+            batch.GraphicsCommands = VK_NULL_HANDLE;
+        }
+        for (const auto& stagingBuffer : batch.StagingBuffers) {
+            vmaDestroyBuffer(vmaAllocator, stagingBuffer.Buffer, stagingBuffer.Allocation);
+        }
+        batch.StagingBuffers.clear();
+    }
+
+    std::optional<StagingSliceVulkan> RHIDeviceVulkan::stageUploadLocked(UploadBatch& batch,
+                                                                         const void* data,
+                                                                         const VkDeviceSize size,
+                                                                         const VkDeviceSize alignment) {
+        if (auto slice = stagingRing.Stage(data, size, alignment, batch.Id)) {
+            return slice;
+        }
+
+        // Full: move to a larger ring if the cap allows. Batches up to this one may still be
+        // reading the old ring, so it is freed along with this batch.
+        if (size <= maxStagingRingSize && stagingRing.Size() < maxStagingRingSize) {
+            const auto grownSize =
+                std::min(maxStagingRingSize, std::bit_ceil(std::max({stagingRing.Size() * 2, stagingRingSize, size})));
+            if (const auto retired = stagingRing.Release(); retired.Buffer != VK_NULL_HANDLE) {
+                batch.StagingBuffers.push_back(retired);
+            }
+            if (stagingRing.Init(vmaAllocator, grownSize)) {
+                spdlog::info("Staging ring grown to {} bytes", grownSize);
+                if (auto slice = stagingRing.Stage(data, size, alignment, batch.Id)) {
+                    return slice;
+                }
+            }
+        }
+
+        // Oversize, or the ring is at its cap and busy: stage through a buffer of its own
+        const VkBufferCreateInfo bufferCreateInfo {
+            .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .size = size,
+            .usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+            .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+            .queueFamilyIndexCount = 0,
+            .pQueueFamilyIndices = nullptr,
+        };
+        const VmaAllocationCreateInfo allocationCreateInfo {
+            .flags = VMA_ALLOCATION_CREATE_MAPPED_BIT,
+            .usage = ConvertMemoryAccessToVulkan(BufferMemoryAccess::CpuToGpu),
+            .requiredFlags = 0,
+            .preferredFlags = 0,
+            .memoryTypeBits = 0,
+            .pool = VK_NULL_HANDLE,
+            .pUserData = nullptr,
+        };
+
+        StagingBufferVulkan staging {};
+        VmaAllocationInfo allocationInfo {};
+        if (const auto result = vmaCreateBuffer(vmaAllocator,
+                                                &bufferCreateInfo,
+                                                &allocationCreateInfo,
+                                                &staging.Buffer,
+                                                &staging.Allocation,
+                                                &allocationInfo);
+            result != VK_SUCCESS) {
+            spdlog::error("Failed to create {} byte staging buffer. Error: {}", size, static_cast<int>(result));
+            return std::nullopt;
+        }
+        std::memcpy(allocationInfo.pMappedData, data, size);
+        vmaFlushAllocation(vmaAllocator, staging.Allocation, 0, size);
+        batch.StagingBuffers.push_back(staging);
+        return StagingSliceVulkan {.Buffer = staging.Buffer, .Offset = 0};
     }
 
     void RHIDeviceVulkan::FreeTexture(RHITextureHandle handle) {
@@ -1970,6 +4231,16 @@ namespace OZZ::rendering::vk {
         });
     }
 
+    uint32_t RHIDeviceVulkan::GetBindlessIndex(const RHITextureHandle& handle) {
+        const auto* texture = texturePool.Get(handle);
+        return texture ? texture->BindlessIndex : InvalidBindlessIndex;
+    }
+
+    uint32_t RHIDeviceVulkan::GetBindlessIndex(const RHIBufferHandle& handle) {
+        const auto* buffers = bufferResourcePool.Get(handle);
+        return buffers ? buffers->front().BindlessIndex : InvalidBindlessIndex;
+    }
+
     RHIShaderHandle RHIDeviceVulkan::CreateShader(ShaderFileParams&& shaderFiles) {
         OZZ_PROFILE_FUNCTION;
 
@@ -1985,6 +4256,8 @@ namespace OZZ::rendering::vk {
             return CreateShader(ShaderSourceParams {
                 .Slang = slangSource,
                 .Defines = std::move(shaderFiles.Defines),
+                .DynamicBindings = std::move(shaderFiles.DynamicBindings),
+                .BindlessSet = shaderFiles.BindlessSet,
             });
         }
 
@@ -2011,6 +4284,8 @@ namespace OZZ::rendering::vk {
             .Geometry = geometrySource,
             .Fragment = fragmentSource,
             .Defines = std::move(shaderFiles.Defines),
+            .DynamicBindings = std::move(shaderFiles.DynamicBindings),
+            .BindlessSet = shaderFiles.BindlessSet,
         });
     }
 
@@ -2021,6 +4296,47 @@ namespace OZZ::rendering::vk {
 #else
         RHIShaderVulkan shader {device, std::move(shaderSources)};
 #endif
+        return registerShader(std::move(shader));
+    }
+
+    RHIShaderHandle RHIDeviceVulkan::CreateComputeShader(ComputeShaderFileParams&& shaderFiles) {
+        OZZ_PROFILE_FUNCTION;
+        const bool bIsSlang = !shaderFiles.Slang.empty();
+        const auto& path = bIsSlang ? shaderFiles.Slang : shaderFiles.Compute;
+        std::ifstream file(path);
+        if (!file.is_open()) {
+            spdlog::error("Failed to open compute shader file: {}", path.string());
+            return RHIShaderHandle::Null();
+        }
+        std::string source((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        if (bIsSlang) {
+            return CreateComputeShader(ComputeShaderSourceParams {
+                .Slang = source,
+                .Defines = std::move(shaderFiles.Defines),
+                .DynamicBindings = std::move(shaderFiles.DynamicBindings),
+                .BindlessSet = shaderFiles.BindlessSet,
+            });
+        }
+        return CreateComputeShader(ComputeShaderSourceParams {
+            .Compute = source,
+            .Defines = std::move(shaderFiles.Defines),
+            .DynamicBindings = std::move(shaderFiles.DynamicBindings),
+            .BindlessSet = shaderFiles.BindlessSet,
+        });
+    }
+
+    RHIShaderHandle RHIDeviceVulkan::CreateComputeShader(ComputeShaderSourceParams&& shaderSources) {
+        OZZ_PROFILE_FUNCTION;
+#ifdef OZZ_SLANG_ENABLED
+        RHIShaderVulkan shader {device, std::move(shaderSources), slangGlobalSession};
+#else
+        RHIShaderVulkan shader {device, std::move(shaderSources)};
+#endif
+        return registerShader(std::move(shader));
+    }
+
+    RHIShaderHandle RHIDeviceVulkan::registerShader(RHIShaderVulkan&& shader) {
         if (!shader.IsCompiled()) {
             spdlog::error("Failed to compile shader. Aborting.");
             return RHIShaderHandle::Null();
@@ -2033,12 +4349,9 @@ namespace OZZ::rendering::vk {
             return RHIShaderHandle::Null();
         }
 
-        // Gather VkDescriptorSetLayout objects (ordered by set index = pool allocation order)
-        std::vector<VkDescriptorSetLayout> vkDsLayouts;
-        vkDsLayouts.reserve(dsLayoutHandles.size());
-        for (const auto& handle : dsLayoutHandles) {
-            vkDsLayouts.push_back(*descriptorSetLayoutResourcePool.Get(handle));
-        }
+        // VkDescriptorSetLayout objects in set index order, including the bindless set's
+        const std::vector<VkDescriptorSetLayout> vkDsLayouts =
+            pipelineLayoutResourcePool.Get(pipelineLayoutHandle)->SetLayouts;
 
         // Gather VkPushConstantRange objects
         std::vector<VkPushConstantRange> vkPushConstants;
@@ -2093,6 +4406,18 @@ namespace OZZ::rendering::vk {
         return shader->descriptorSetLayoutHandles;
     }
 
+    // Dynamic offsets have no descriptor buffer equivalent, so such sets stay in the pools
+    static bool HasDynamicDescriptors(const RHIDescriptorSetLayoutDescriptor& descriptor) {
+        for (auto i = 0U; i < descriptor.BindingCount; i++) {
+            const auto& binding = descriptor.Bindings[i];
+            if (binding.Count > 0 && (binding.Type == DescriptorType::UniformBufferDynamic ||
+                                      binding.Type == DescriptorType::StorageBufferDynamic)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
     std::pair<RHIPipelineLayoutHandle, std::set<RHIDescriptorSetLayoutHandle>>
     RHIDeviceVulkan::CreatePipelineLayout(const RHIPipelineLayoutDescriptor& pipelineLayoutDescriptor) {
         OZZ_PROFILE_FUNCTION;
@@ -2105,25 +4430,50 @@ namespace OZZ::rendering::vk {
             }
         };
 
-        for (auto i = 0U; i < pipelineLayoutDescriptor.SetCount; i++) {
-            auto descriptorSetLayoutHandle = CreateDescriptorSetLayout(pipelineLayoutDescriptor.Sets[i]);
+        // The bindless set takes the device's layout in place of a reflected one
+        const auto bindlessSet = pipelineLayoutDescriptor.BindlessSet;
+        if (bindlessSet && !bindlessHeap.IsEnabled()) {
+            spdlog::error("Failed to create pipeline layout. Bindless set requested, but bindless is not enabled");
+            return {RHIPipelineLayoutHandle::Null(), {}};
+        }
+        if (bindlessSet && *bindlessSet >= MaxDescriptorSets) {
+            spdlog::error("Failed to create pipeline layout. Bindless set index {} exceeds MaxDescriptorSets ({})",
+                          *bindlessSet,
+                          MaxDescriptorSets);
+            return {RHIPipelineLayoutHandle::Null(), {}};
+        }
+        const uint32_t setCount = bindlessSet ? std::max(pipelineLayoutDescriptor.SetCount, *bindlessSet + 1)
+                                              : pipelineLayoutDescriptor.SetCount;
+
+        // A layout's sets are either all in the descriptor buffer or all in pools. One dynamic
+        // set, or the bindless set, which is a pool set, keeps every set of the layout in pools.
+        bool bUseDescriptorBuffer = bDescriptorBuffer && !bindlessSet;
+        for (auto i = 0U; i < setCount && bUseDescriptorBuffer; i++) {
+            bUseDescriptorBuffer = !HasDynamicDescriptors(pipelineLayoutDescriptor.Sets[i]);
+        }
+
+        std::vector<VkDescriptorSetLayout> descriptorSetLayouts;
+        descriptorSetLayouts.reserve(setCount);
+        for (auto i = 0U; i < setCount; i++) {
+            if (bindlessSet == i) {
+                descriptorSetLayouts.push_back(bindlessHeap.Layout());
+                continue;
+            }
+            auto descriptorSetLayoutHandle =
+                createDescriptorSetLayoutInternal(pipelineLayoutDescriptor.Sets[i], bUseDescriptorBuffer);
             if (descriptorSetLayoutHandle == RHIDescriptorSetLayoutHandle::Null()) {
                 spdlog::error("Failed to create pipeline layout. Aborting process. See logs for details.");
                 cleanOnFailure();
                 return {RHIPipelineLayoutHandle::Null(), {}};
             }
             descriptorSetLayoutHandles.insert(descriptorSetLayoutHandle);
+            descriptorSetLayouts.push_back(descriptorSetLayoutResourcePool.Get(descriptorSetLayoutHandle)->Layout);
         }
-        std::vector<VkDescriptorSetLayout> descriptorSetLayouts;
-        descriptorSetLayouts.reserve(descriptorSetLayoutHandles.size());
-        std::ranges::transform(descriptorSetLayoutHandles,
-                               std::back_inserter(descriptorSetLayouts),
-                               [this](const RHIDescriptorSetLayoutHandle& handle) {
-                                   return *descriptorSetLayoutResourcePool.Get(handle);
-                               });
 
         std::vector<VkPushConstantRange> pushConstantRanges {pipelineLayoutDescriptor.PushConstantCount};
 
+        // Union of every stage the layout is visible to; decides the descriptor bind point.
+        VkShaderStageFlags layoutStages = 0;
         for (auto i = 0U; i < pipelineLayoutDescriptor.PushConstantCount; i++) {
             const auto& src = pipelineLayoutDescriptor.PushConstants[i];
             pushConstantRanges[i] = {
@@ -2131,6 +4481,14 @@ namespace OZZ::rendering::vk {
                 .offset = src.Offset,
                 .size = src.Size,
             };
+            layoutStages |= pushConstantRanges[i].stageFlags;
+        }
+        for (auto i = 0U; i < setCount; i++) {
+            const auto& set = pipelineLayoutDescriptor.Sets[i];
+            for (auto b = 0U; b < set.BindingCount; b++) {
+                if (set.Bindings[b].Count == 0) continue;
+                layoutStages |= ConvertShaderStageFlagsToVulkan(set.Bindings[b].StageFlags);
+            }
         }
 
         VkPipelineLayoutCreateInfo pipelineLayoutCreateInfo {
@@ -2149,18 +4507,48 @@ namespace OZZ::rendering::vk {
             cleanOnFailure();
             return {RHIPipelineLayoutHandle::Null(), {}};
         };
-        pipelineLayoutHandle = pipelineLayoutResourcePool.Allocate(std::move(pipelineLayout));
+        pipelineLayoutHandle = pipelineLayoutResourcePool.Allocate(RHIPipelineLayoutVulkan {
+            .Layout = pipelineLayout,
+            .BindPoint = layoutStages == VK_SHADER_STAGE_COMPUTE_BIT ? VK_PIPELINE_BIND_POINT_COMPUTE
+                                                                     : VK_PIPELINE_BIND_POINT_GRAPHICS,
+            .SetLayouts = std::move(descriptorSetLayouts),
+            .BindlessSet = bindlessSet,
+            .bDescriptorBuffer = bUseDescriptorBuffer,
+        });
         return {pipelineLayoutHandle, descriptorSetLayoutHandles};
     }
 
     RHIDescriptorSetLayoutHandle
-    RHIDeviceVulkan::CreateDescriptorSetLayout(const RHIDescriptorSetLayoutDescriptor& descriptorSetLayoutDescriptor) {
+    RHIDeviceVulkan::CreateDescriptorSetLayout(const RHIDescriptorSetLayoutDescriptor& descriptorSetLayoutDescriptor,
+                                               const RHIPipelineLayoutHandle& pipelineLayoutHandle) {
+        OZZ_PROFILE_FUNCTION;
+        // Without a pipeline layout to match, pools: the sets then bind to any layout with a
+        // dynamic or bindless set, which could never take descriptor buffer sets
+        if (!pipelineLayoutHandle.IsValid()) {
+            return createDescriptorSetLayoutInternal(descriptorSetLayoutDescriptor, false);
+        }
+        const auto* pipelineLayout = pipelineLayoutResourcePool.Get(pipelineLayoutHandle);
+        if (!pipelineLayout) {
+            spdlog::error("CreateDescriptorSetLayout: invalid pipeline layout handle");
+            return RHIDescriptorSetLayoutHandle::Null();
+        }
+        if (pipelineLayout->bDescriptorBuffer && HasDynamicDescriptors(descriptorSetLayoutDescriptor)) {
+            spdlog::error("CreateDescriptorSetLayout: dynamic bindings can not be used with a descriptor buffer "
+                          "pipeline layout");
+            return RHIDescriptorSetLayoutHandle::Null();
+        }
+        return createDescriptorSetLayoutInternal(descriptorSetLayoutDescriptor, pipelineLayout->bDescriptorBuffer);
+    }
+
+    RHIDescriptorSetLayoutHandle
+    RHIDeviceVulkan::createDescriptorSetLayoutInternal(const RHIDescriptorSetLayoutDescriptor& descriptor,
+                                                       const bool bForDescriptorBuffer) {
         RHIDescriptorSetLayoutHandle handle {RHIDescriptorSetLayoutHandle::Null()};
         // build up the bindings, skipping empty slots (Count == 0)
         std::vector<VkDescriptorSetLayoutBinding> bindings;
-        bindings.reserve(descriptorSetLayoutDescriptor.BindingCount);
-        for (auto i = 0U; i < descriptorSetLayoutDescriptor.BindingCount; i++) {
-            const auto& srcBinding = descriptorSetLayoutDescriptor.Bindings[i];
+        bindings.reserve(descriptor.BindingCount);
+        for (auto i = 0U; i < descriptor.BindingCount; i++) {
+            const auto& srcBinding = descriptor.Bindings[i];
             if (srcBinding.Count == 0) continue;
             bindings.push_back({
                 .binding = srcBinding.Binding,
@@ -2173,7 +4561,8 @@ namespace OZZ::rendering::vk {
         VkDescriptorSetLayoutCreateInfo layoutCreateInfo {
             .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
             .pNext = nullptr,
-            .flags = 0,
+            .flags = bForDescriptorBuffer ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT
+                                          : VkDescriptorSetLayoutCreateFlags {0},
             .bindingCount = static_cast<uint32_t>(bindings.size()),
             .pBindings = bindings.empty() ? nullptr : bindings.data(),
         };
@@ -2185,7 +4574,22 @@ namespace OZZ::rendering::vk {
             return handle;
         }
 
-        return descriptorSetLayoutResourcePool.Allocate(std::move(layout));
+        RHIDescriptorSetLayoutVulkan layoutVulkan {
+            .Layout = layout,
+            .DescriptorCounts = CountDescriptors(bindings),
+            .bDescriptorBuffer = bForDescriptorBuffer,
+        };
+        if (bForDescriptorBuffer) {
+            vkGetDescriptorSetLayoutSizeEXT(device, layout, &layoutVulkan.Size);
+            for (const auto& binding : bindings) {
+                if (binding.binding >= layoutVulkan.BindingOffsets.size()) {
+                    layoutVulkan.BindingOffsets.resize(binding.binding + 1, InvalidBindingOffset);
+                }
+                vkGetDescriptorSetLayoutBindingOffsetEXT(
+                    device, layout, binding.binding, &layoutVulkan.BindingOffsets[binding.binding]);
+            }
+        }
+        return descriptorSetLayoutResourcePool.Allocate(std::move(layoutVulkan));
     }
 
     void RHIDeviceVulkan::FreeShader(const RHIShaderHandle& shaderHandle) {
@@ -2197,8 +4601,11 @@ namespace OZZ::rendering::vk {
 
     RHIBufferHandle RHIDeviceVulkan::CreateBuffer(BufferDescriptor&& bufferDescriptor) {
         OZZ_PROFILE_FUNCTION;
-        std::array<RHIBufferVulkan, MaxFramesInFlight> buffers;
+        std::vector<RHIBufferVulkan> buffers(bufferDescriptor.Lifetime == BufferLifetime::Static ? 1 : framesInFlight);
         size_t createdBuffers = 0;
+        // Descriptor buffers reference the buffers descriptors point at by address
+        const bool bNeedsAddress =
+            bDescriptorBuffer && has(bufferDescriptor.Usage, BufferUsage::UniformBuffer | BufferUsage::StorageBuffer);
 
         for (auto& buffer : buffers) {
             VkBufferCreateInfo bufferCreateInfo {
@@ -2206,7 +4613,11 @@ namespace OZZ::rendering::vk {
                 .pNext = nullptr,
                 .flags = 0,
                 .size = bufferDescriptor.Size,
-                .usage = ConvertBufferUsageToVulkan(bufferDescriptor.Usage),
+                // GpuOnly buffers are filled through staging copies
+                .usage = ConvertBufferUsageToVulkan(bufferDescriptor.Usage) |
+                         (bufferDescriptor.Access == BufferMemoryAccess::GpuOnly ? VK_BUFFER_USAGE_TRANSFER_DST_BIT
+                                                                                 : VkBufferUsageFlags {0}) |
+                         (bNeedsAddress ? VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT : VkBufferUsageFlags {0}),
                 .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
                 .queueFamilyIndexCount = 0,
                 .pQueueFamilyIndices = nullptr,
@@ -2236,14 +4647,34 @@ namespace OZZ::rendering::vk {
                 return RHIBufferHandle::Null();
             }
 
+            buffer.Size = bufferDescriptor.Size;
+            if (bNeedsAddress) {
+                const VkBufferDeviceAddressInfo addressInfo {
+                    .sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO,
+                    .pNext = nullptr,
+                    .buffer = buffer.Buffer,
+                };
+                buffer.DeviceAddress = vkGetBufferDeviceAddress(device, &addressInfo);
+            }
             buffer.Access = bufferDescriptor.Access;
             buffer.Usage = bufferDescriptor.Usage;
+            buffer.Lifetime = bufferDescriptor.Lifetime;
             createdBuffers++;
         }
 
-        const auto handle = bufferResourcePool.Allocate(std::move(buffers));
+        // Only copy 0 is registered, which leaves out Stream buffers: their data lives in the
+        // recording frame's copy
+        if (has(bufferDescriptor.Usage, BufferUsage::StorageBuffer) &&
+            bufferDescriptor.Lifetime != BufferLifetime::Stream) {
+            buffers.front().BindlessIndex = bindlessHeap.AddBuffer(buffers.front().Buffer);
+        }
 
-        return handle;
+        // Every copy, Stream ones included: no frame has used any of them yet
+        if (bufferDescriptor.InitialData) {
+            updateBufferCopies(buffers, bufferDescriptor.InitialData, bufferDescriptor.Size, 0);
+        }
+
+        return bufferResourcePool.Allocate(std::move(buffers));
     }
 
     void
@@ -2255,13 +4686,32 @@ namespace OZZ::rendering::vk {
             return;
         }
 
-        for (const auto& buffer : *buffers) {
-            // ensure usage is CPU accessible
-            if (buffer.Access == BufferMemoryAccess::GpuOnly) {
-                spdlog::error("Failed to update buffer. Buffer is not CPU accessible.");
+        // Stream buffers are rewritten every frame, so only the recording frame's copy is stale.
+        // Outside BeginFrame..SubmitAndPresentFrame there is no such frame, and the copy the
+        // global frame index points at may still be read by the GPU.
+        auto targets = std::span<const RHIBufferVulkan> {*buffers};
+        if (buffers->front().Lifetime == BufferLifetime::Stream) {
+            const uint32_t frameIndex = recordingFrame.load(std::memory_order_acquire);
+            if (frameIndex == NoRecordingFrame) {
+                spdlog::error("Failed to update buffer. Stream buffers can only be updated between BeginFrame and "
+                              "SubmitAndPresentFrame.");
                 return;
             }
+            targets = targets.subspan(frameIndex % buffers->size(), 1);
+        }
+        updateBufferCopies(targets, data, size, offset);
+    }
+
+    void RHIDeviceVulkan::updateBufferCopies(std::span<const RHIBufferVulkan> targets,
+                                             const void* data,
+                                             size_t size,
+                                             size_t offset) {
+        if (targets.front().Access == BufferMemoryAccess::GpuOnly) {
+            updateBufferStaged(targets, data, size, offset);
+            return;
+        }
 
+        for (const auto& buffer : targets) {
             // make sure offset + size does not exceed buffer size
             if (offset + size > buffer.AllocationInfo.size) {
                 spdlog::error("Failed to update buffer. Data size exceeds buffer size.");
@@ -2278,6 +4728,133 @@ namespace OZZ::rendering::vk {
         }
     }
 
+    void RHIDeviceVulkan::updateBufferStaged(std::span<const RHIBufferVulkan> buffers,
+                                             const void* data,
+                                             size_t size,
+                                             size_t offset) {
+        if (offset + size > buffers.front().AllocationInfo.size) {
+            spdlog::error("Failed to update buffer. Data size exceeds buffer size.");
+            return;
+        }
+        if (size == 0) {
+            return;
+        }
+
+        // Buffer copies stay on the graphics queue even with a transfer queue: the buffer may be
+        // in use by frames already submitted there, and the barriers below order the copy after them
+        std::lock_guard lock(uploadMutex);
+        auto& batch = openUploadBatch;
+        if (batch.GraphicsCommands == VK_NULL_HANDLE) {
+            batch.GraphicsCommands = beginSingleTimeCommands(graphicsQueue);
+            if (batch.GraphicsCommands == VK_NULL_HANDLE) {
+                return;
+            }
+        }
+        const auto staged = stageUploadLocked(batch, data, size, 4);
+        if (!staged) {
+            return;
+        }
+
+        const auto recordBarriers = [&](const VkPipelineStageFlags2 srcStage,
+                                        const VkAccessFlags2 srcAccess,
+                                        const VkPipelineStageFlags2 dstStage,
+                                        const VkAccessFlags2 dstAccess) {
+            std::vector<VkBufferMemoryBarrier2> barriers;
+            barriers.reserve(buffers.size());
+            for (const auto& buffer : buffers) {
+                barriers.push_back({
+                    .sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2,
+                    .pNext = nullptr,
+                    .srcStageMask = srcStage,
+                    .srcAccessMask = srcAccess,
+                    .dstStageMask = dstStage,
+                    .dstAccessMask = dstAccess,
+                    .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                    .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                    .buffer = buffer.Buffer,
+                    .offset = offset,
+                    .size = size,
+                });
+            }
+            const VkDependencyInfo dependencyInfo {
+                .sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
+                .pNext = nullptr,
+                .dependencyFlags = 0,
+                .memoryBarrierCount = 0,
+                .pMemoryBarriers = nullptr,
+                .bufferMemoryBarrierCount = static_cast<uint32_t>(barriers.size()),
+                .pBufferMemoryBarriers = barriers.data(),
+                .imageMemoryBarrierCount = 0,
+                .pImageMemoryBarriers = nullptr,
+            };
+            vkCmdPipelineBarrier2(batch.GraphicsCommands, &dependencyInfo);
+        };
+
+        // Earlier work may still read or write the range being replaced
+        recordBarriers(VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+                       VK_ACCESS_2_MEMORY_WRITE_BIT,
+                       VK_PIPELINE_STAGE_2_TRANSFER_BIT,
+                       VK_ACCESS_2_TRANSFER_WRITE_BIT);
+        for (const auto& buffer : buffers) {
+            const VkBufferCopy region {
+                .srcOffset = staged->Offset,
+                .dstOffset = offset,
+                .size = size,
+            };
+            vkCmdCopyBuffer(batch.GraphicsCommands, staged->Buffer, buffer.Buffer, 1, &region);
+        }
+        recordBarriers(VK_PIPELINE_STAGE_2_TRANSFER_BIT,
+                       VK_ACCESS_2_TRANSFER_WRITE_BIT,
+                       VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+                       VK_ACCESS_2_MEMORY_READ_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT);
+    }
+
+    const RHIBufferVulkan& RHIDeviceVulkan::resolveBuffer(const std::vector<RHIBufferVulkan>& buffers,
+                                                          const uint32_t frameIndex) {
+        return buffers.size() == 1 ? buffers.front() : buffers[frameIndex];
+    }
+
+    TransientAllocation
+    RHIDeviceVulkan::AllocateTransient(const RHIFrameContext& frameContext, uint64_t size, BufferUsage usage) {
+        OZZ_PROFILE_FUNCTION;
+        const auto* buffers = bufferResourcePool.Get(transientBuffer);
+        if (!buffers) {
+            spdlog::error("AllocateTransient: no transient buffer (TransientBufferSize is 0)");
+            return {};
+        }
+
+        const auto& limits = physicalDevices.SelectedDevice().Properties.properties.limits;
+        VkDeviceSize alignment = 4;
+        if (has(usage, BufferUsage::UniformBuffer)) {
+            alignment = std::max(alignment, limits.minUniformBufferOffsetAlignment);
+        }
+        if (has(usage, BufferUsage::StorageBuffer)) {
+            alignment = std::max(alignment, limits.minStorageBufferOffsetAlignment);
+        }
+
+        const auto frameIndex = GetFrameNumberFromFrameContext(frameContext);
+        auto& submissionContext = submissionContexts[frameIndex];
+        VkDeviceSize offset;
+        {
+            std::lock_guard lock(transientMutex);
+            offset = (submissionContext.TransientHead + alignment - 1) / alignment * alignment;
+            if (offset + size > transientSliceSize) {
+                spdlog::error("AllocateTransient: {} bytes requested, frame's {} byte transient budget is used up",
+                              size,
+                              transientSliceSize);
+                return {};
+            }
+            submissionContext.TransientHead = offset + size;
+        }
+
+        const auto bufferOffset = frameIndex * transientSliceSize + offset;
+        return {
+            .Buffer = transientBuffer,
+            .Offset = bufferOffset,
+            .Mapped = static_cast<uint8_t*>(buffers->front().AllocationInfo.pMappedData) + bufferOffset,
+        };
+    }
+
     void RHIDeviceVulkan::FreeBuffer(const RHIBufferHandle& bufferHandle) {
         std::lock_guard lock(deletionQueueMutex);
         perFrameDeletions[currentFrame].emplace_back([this, bufferHandle]() {
@@ -5,17 +5,28 @@
 #pragma once
 
 #include "ozz_rendering/utils/resource_pool.h"
+#include "bindless_heap_vulkan.h"
 #include "rhi_buffer_vulkan.h"
+#include "descriptor_allocator_vulkan.h"
+#include "descriptor_buffer_vulkan.h"
+#include "rhi_command_buffer_vulkan.h"
+#include "rhi_graphics_state_vulkan.h"
 
 #include "rhi_shader_vulkan.h"
 #include "rhi_texture_vulkan.h"
+#include "staging_ring_vulkan.h"
 #include "utils/physical_devices.h"
 
 #include <ozz_rendering/rhi_device.h>
 #include <ozz_rendering/profiling.h>
 
 #include <array>
+#include <atomic>
+#include <deque>
 #include <mutex>
+#include <optional>
+#include <set>
+#include <span>
 
 // TracyVulkan.hpp provides TracyVkCtx type and the TracyVk* macros that
 // the OZZ_GPU_* macros in profiling.h expand to.  It must come after
@@ -31,19 +42,98 @@ using TracyVkCtx = void*;
 #endif
 
 namespace OZZ::rendering::vk {
-    constexpr uint32_t MaxFramesInFlight = 2;
+    // A device queue plus everything needed to submit to it from any thread. Each queue
+    // signals its own timeline semaphore: signal values must increase in execution order,
+    // which one timeline shared by independently running queues cannot guarantee.
+    struct DeviceQueue {
+        VkQueue Queue {VK_NULL_HANDLE};
+        uint32_t Family {UINT32_MAX};
+
+        // Values are handed out under SubmitMutex so they increase in submission order.
+        // SubmitMutex also serializes vkQueuePresentKHR on the graphics queue.
+        VkSemaphore Timeline {VK_NULL_HANDLE};
+        std::atomic<uint64_t> SubmittedValue {0};
+        std::mutex SubmitMutex;
+
+        // One-off command buffers (uploads, layout transitions) for this queue's family
+        VkCommandPool TransientPool {VK_NULL_HANDLE};
+        std::set<VkCommandBuffer> TransientBuffers;
+        std::mutex TransientPoolMutex;
+    };
+
+    // A pipeline layout and the bind point its descriptor sets go to. Layouts whose declared
+    // stages are all Compute bind at VK_PIPELINE_BIND_POINT_COMPUTE, everything else at graphics.
+    struct RHIPipelineLayoutVulkan {
+        VkPipelineLayout Layout {VK_NULL_HANDLE};
+        VkPipelineBindPoint BindPoint {VK_PIPELINE_BIND_POINT_GRAPHICS};
+        // Set layouts in set index order, including the bindless one
+        std::vector<VkDescriptorSetLayout> SetLayouts {};
+        // Index the global bindless set is bound at when a shader using this layout is bound
+        std::optional<uint32_t> BindlessSet {};
+        // Set layouts were created for the descriptor buffer, so its sets are bound by offset
+        bool bDescriptorBuffer {false};
+    };
+
+    // The state an upload leaves a texture in, tracked once its batch is submitted
+    struct UploadTextureState {
+        RHITextureHandle Texture {};
+        // Final barrier of the upload; its destination is the texture's state afterwards
+        VkImageMemoryBarrier2 Barrier {};
+        // Tracked layout of each subresource when the upload was recorded
+        std::vector<VkImageLayout> RecordedLayouts {};
+    };
+
+    // Texture copies recorded by UpdateTextureAsync and submitted together. With a dedicated
+    // transfer queue, copies and release barriers go to TransferCommands and the matching
+    // acquires to GraphicsCommands; otherwise everything is recorded into GraphicsCommands.
+    struct UploadBatch {
+        uint64_t Id {0};
+        VkCommandBuffer TransferCommands {VK_NULL_HANDLE};
+        VkCommandBuffer GraphicsCommands {VK_NULL_HANDLE};
+        // Dedicated staging buffers, and staging rings replaced while this batch was open
+        std::vector<StagingBufferVulkan> StagingBuffers {};
+        std::vector<UploadTextureState> TextureStates {};
+        // Graphics timeline value that completes the batch, set on submission
+        uint64_t TimelineValue {0};
+    };
 
     struct SubmissionContext {
         VkSemaphore AcquireImageSemaphore {VK_NULL_HANDLE};
         // VkSemaphore RenderCompleteSemaphore {VK_NULL_HANDLE};
-        VkFence InFlightFence {VK_NULL_HANDLE};
+        // Device timeline value signaled by this slot's last submission (0 = never submitted).
+        // BeginFrame waits for it before reusing the slot.
+        uint64_t TimelineValue {0};
 
         RHICommandBufferHandle CommandBuffer {};
+        // Primaries CommandBuffer records into. FlushGraphics submits the current one and moves
+        // on to the next, so one frame may span several submissions; BeginFrame rewinds to [0].
+        std::vector<VkCommandBuffer> GraphicsCommandBuffers {};
+        uint32_t NextGraphicsCommandBuffer {0};
+        // Set by BeginFrame, cleared by the frame's first submission, which is the one that
+        // waits on AcquireImageSemaphore.
+        bool bAcquireWaitPending {false};
+
+        // One pool per forked recording context, created on first use and reset in
+        // BeginFrame once this slot's previous submission has retired.
+        std::vector<FrameCommandPool> ParallelPools {};
+
+        // Async compute contexts handed out for this slot, and the compute timeline value its
+        // last one signaled. BeginFrame waits for it before recycling the pool.
+        FrameCommandPool ComputePool {};
+        uint64_t ComputeTimelineValue {0};
+
+        // Bytes of this slot's share of the transient buffer handed out this frame, guarded by
+        // transientMutex
+        VkDeviceSize TransientHead {0};
+        // Sets AllocateTransientDescriptorSet handed out this frame and the arena they came from,
+        // guarded by transientMutex. BeginFrame frees the handles and resets the arena in bulk.
+        TransientDescriptorArenaVulkan TransientDescriptors {};
+        std::vector<RHIDescriptorSetHandle> TransientDescriptorSets {};
     };
 
     class RHIDeviceVulkan : public RHIDevice {
     public:
-        explicit RHIDeviceVulkan(const PlatformContext& context);
+        explicit RHIDeviceVulkan(const RHIInitParams& params);
         ~RHIDeviceVulkan() override;
 
         // Frame
@@ -51,6 +141,30 @@ namespace OZZ::rendering::vk {
         void SubmitAndPresentFrame(RHIFrameContext&& frameContext) override;
         std::pair<uint32_t, uint32_t> GetSwapchainExtent() const override;
 
+        // GPU progress
+        uint64_t GetSubmittedGpuValue() const override;
+        uint64_t GetCompletedGpuValue() const override;
+        bool WaitForGpuValue(uint64_t value, uint64_t timeoutNs) override;
+
+        // Parallel recording
+        std::vector<RHIFrameContext> ForkRecordingContexts(const RHIFrameContext& frameContext,
+                                                           uint32_t count) override;
+        void JoinRecordingContexts(const RHIFrameContext& frameContext,
+                                   std::vector<RHIFrameContext>&& recordingContexts) override;
+
+        // Async compute
+        RHIFrameContext BeginAsyncCompute(const RHIFrameContext& frameContext) override;
+        GpuSyncPoint SubmitAsyncCompute(RHIFrameContext&& computeContext) override;
+        GpuSyncPoint FlushGraphics(const RHIFrameContext& frameContext) override;
+        void AddQueueDependency(const RHIFrameContext& context,
+                                const GpuSyncPoint& syncPoint,
+                                PipelineStage waitStage) override;
+        uint32_t GetQueueFamily(QueueType queue) const override;
+
+        // Graphics state objects
+        RHIGraphicsStateHandle CreateGraphicsState(const GraphicsStateDescriptor& graphicsStateDescriptor) override;
+        void FreeGraphicsState(const RHIGraphicsStateHandle& graphicsStateHandle) override;
+
         // Command Buffer Recording - Render Pass
         void BeginRenderPass(const RHIFrameContext& frameContext, const RenderPassDescriptor&) override;
         void EndRenderPass(const RHIFrameContext& frameContext) override;
@@ -58,15 +172,32 @@ namespace OZZ::rendering::vk {
         // Command Buffer Recording - Barriers
         void TextureResourceBarrier(const RHIFrameContext& frameContext, const TextureBarrierDescriptor&) override;
         void BufferMemoryBarrier(const RHIFrameContext& frameContext, const BufferBarrierDescriptor&) override;
+        void PipelineBarriers(const RHIFrameContext& frameContext,
+                              std::span<const TextureBarrierDescriptor> textureBarriers,
+                              std::span<const BufferBarrierDescriptor> bufferBarriers) override;
+        void TransitionTexture(const RHIFrameContext& frameContext,
+                               const RHITextureHandle& textureHandle,
+                               TextureState newState,
+                               const TextureSubresourceRange& subresourceRange) override;
 
         // Command Buffer Recording - State
         void SetViewport(const RHIFrameContext& frameContext, const Viewport&) override;
         void SetScissor(const RHIFrameContext& frameContext, const Scissor&) override;
         void SetGraphicsState(const RHIFrameContext& frameContext, const GraphicsStateDescriptor&) override;
+        void SetGraphicsState(const RHIFrameContext& frameContext, const RHIGraphicsStateHandle&) override;
+        uint64_t GetElidedStateCommandCount() const override;
 
         // Command Buffer Recording - Binding
         void BindShader(const RHIFrameContext&, const RHIShaderHandle&) override;
         void BindBuffer(const RHIFrameContext& frameContext, const RHIBufferHandle& bufferHandle) override;
+        void BindVertexBuffers(const RHIFrameContext& frameContext,
+                               uint32_t firstBinding,
+                               std::span<const RHIBufferHandle> bufferHandles,
+                               std::span<const uint64_t> offsets) override;
+        void BindIndexBuffer(const RHIFrameContext& frameContext,
+                             const RHIBufferHandle& bufferHandle,
+                             uint64_t offset,
+                             IndexType indexType) override;
         void SetPushConstants(const RHIFrameContext& frameContext,
                               RHIPipelineLayoutHandle pipelineLayoutHandle,
                               ShaderStageFlags stageFlags,
@@ -76,7 +207,8 @@ namespace OZZ::rendering::vk {
         void BindDescriptorSet(const RHIFrameContext& frameContext,
                                RHIPipelineLayoutHandle pipelineLayoutHandle,
                                uint32_t setIndex,
-                               RHIDescriptorSetHandle descriptorSetHandle) override;
+                               RHIDescriptorSetHandle descriptorSetHandle,
+                               std::span<const uint32_t> dynamicOffsets) override;
 
         // Command Buffer Recording - Draw
         void Draw(const RHIFrameContext& frameContext,
@@ -90,19 +222,62 @@ namespace OZZ::rendering::vk {
                          uint32_t firstIndex,
                          int32_t vertexOffset,
                          uint32_t firstInstance) override;
+        void DrawIndirect(const RHIFrameContext& frameContext,
+                          const RHIBufferHandle& argumentBuffer,
+                          uint64_t offset,
+                          uint32_t drawCount,
+                          uint32_t stride) override;
+        void DrawIndexedIndirect(const RHIFrameContext& frameContext,
+                                 const RHIBufferHandle& argumentBuffer,
+                                 uint64_t offset,
+                                 uint32_t drawCount,
+                                 uint32_t stride) override;
+        void DrawIndirectCount(const RHIFrameContext& frameContext,
+                               const RHIBufferHandle& argumentBuffer,
+                               uint64_t offset,
+                               const RHIBufferHandle& countBuffer,
+                               uint64_t countOffset,
+                               uint32_t maxDrawCount,
+                               uint32_t stride) override;
+        void DrawIndexedIndirectCount(const RHIFrameContext& frameContext,
+                                      const RHIBufferHandle& argumentBuffer,
+                                      uint64_t offset,
+                                      const RHIBufferHandle& countBuffer,
+                                      uint64_t countOffset,
+                                      uint32_t maxDrawCount,
+                                      uint32_t stride) override;
+
+        // Command Buffer Recording - Compute
+        void Dispatch(const RHIFrameContext& frameContext,
+                      uint32_t groupCountX,
+                      uint32_t groupCountY,
+                      uint32_t groupCountZ) override;
+        void DispatchIndirect(const RHIFrameContext& frameContext,
+                              const RHIBufferHandle& bufferHandle,
+                              uint64_t offset) override;
 
         // Descriptor Sets
         RHIDescriptorSetHandle CreateDescriptorSet(RHIDescriptorSetLayoutHandle layoutHandle) override;
         void UpdateDescriptorSet(RHIDescriptorSetHandle handle, std::span<const RHIDescriptorWrite> writes) override;
         void FreeDescriptorSet(RHIDescriptorSetHandle handle) override;
+        RHIDescriptorSetHandle AllocateTransientDescriptorSet(const RHIFrameContext& frameContext,
+                                                              RHIDescriptorSetLayoutHandle layoutHandle) override;
 
         // Resource Creation
         RHITextureHandle CreateTexture(TextureDescriptor&& descriptor) override;
         void UpdateTexture(const RHITextureHandle& handle, const void* data, size_t size) override;
         void FreeTexture(RHITextureHandle handle) override;
+        uint32_t GetBindlessIndex(const RHITextureHandle& handle) override;
+        uint32_t GetBindlessIndex(const RHIBufferHandle& handle) override;
+        UploadTicket UpdateTextureAsync(const RHITextureHandle& handle, const void* data, size_t size) override;
+        UploadTicket SubmitUploads() override;
+        bool IsUploadComplete(const UploadTicket& ticket) override;
+        bool WaitForUpload(const UploadTicket& ticket, uint64_t timeoutNs) override;
 
         RHIShaderHandle CreateShader(ShaderFileParams&& shaderFiles) override;
         RHIShaderHandle CreateShader(ShaderSourceParams&& shaderSources) override;
+        RHIShaderHandle CreateComputeShader(ComputeShaderFileParams&& shaderFiles) override;
+        RHIShaderHandle CreateComputeShader(ComputeShaderSourceParams&& shaderSources) override;
         void FreeShader(const RHIShaderHandle&) override;
         RHIPipelineLayoutDescriptor GetShaderPipelineLayout(const RHIShaderHandle& shaderHandle) override;
         RHIPipelineLayoutHandle GetShaderPipelineLayoutHandle(const RHIShaderHandle& shaderHandle) override;
@@ -111,10 +286,13 @@ namespace OZZ::rendering::vk {
         std::pair<RHIPipelineLayoutHandle, std::set<RHIDescriptorSetLayoutHandle>>
         CreatePipelineLayout(const RHIPipelineLayoutDescriptor& pipelineLayoutDescriptor) override;
         RHIDescriptorSetLayoutHandle
-        CreateDescriptorSetLayout(const RHIDescriptorSetLayoutDescriptor& descriptorSetLayoutDescriptor) override;
+        CreateDescriptorSetLayout(const RHIDescriptorSetLayoutDescriptor& descriptorSetLayoutDescriptor,
+                                  const RHIPipelineLayoutHandle& pipelineLayoutHandle) override;
 
         RHIBufferHandle CreateBuffer(BufferDescriptor&& bufferDescriptor) override;
         void UpdateBuffer(const RHIBufferHandle&, const void* data, size_t size, size_t offset) override;
+        TransientAllocation
+        AllocateTransient(const RHIFrameContext& frameContext, uint64_t size, BufferUsage usage) override;
         void FreeBuffer(const RHIBufferHandle& bufferHandle) override;
 
     private:
@@ -125,71 +303,248 @@ namespace OZZ::rendering::vk {
         bool createSurface();
         bool createDevice();
         bool createSwapchain(VkSwapchainKHR oldSwapchain = VK_NULL_HANDLE);
+        bool createSwapchainDepthTextures();
         bool createCommandBufferPool();
+        bool createTransientCommandPool(DeviceQueue& queue);
+        bool createTimelineSemaphore(DeviceQueue& queue);
         bool createSubmissionContexts();
+        bool createTransientBuffer();
         bool initializeQueue();
-        bool createDescriptorPool();
 
         // Swapchain recreation
         void destroySwapchainResources();
         bool recreateSwapchain();
 
         // Immediate more command buffers
-        VkCommandBuffer beginSingleTimeCommands();
-        void endSingleTimeCommands(VkCommandBuffer commandBuffer);
+        VkCommandBuffer beginSingleTimeCommands(DeviceQueue& queue);
+        void endSingleTimeCommands(DeviceQueue& queue, VkCommandBuffer commandBuffer);
+        void freeSingleTimeCommands(DeviceQueue& queue, VkCommandBuffer commandBuffer);
+
+        // Upload batching. Callers hold uploadMutex. submitUploadBatchLocked submits the open
+        // batch if it recorded anything; retireUploadBatchesLocked releases the staging buffers
+        // and command buffers of batches the GPU has finished. applyUploadTextureStates moves
+        // the tracked state of a submitted batch's textures to where the uploads leave them.
+        void submitUploadBatchLocked();
+        void applyUploadTextureStates(const UploadBatch& batch);
+        void retireUploadBatchesLocked();
+        void releaseUploadBatch(UploadBatch& batch);
+        // Copies data into the staging ring, growing it if needed, or into a dedicated staging
+        // buffer owned by the batch. Caller holds uploadMutex.
+        std::optional<StagingSliceVulkan>
+        stageUploadLocked(UploadBatch& batch, const void* data, VkDeviceSize size, VkDeviceSize alignment);
+        // Writes data into each of the given copies of one buffer: straight into the mapping, or
+        // through updateBufferStaged when the CPU cannot map it
+        void updateBufferCopies(std::span<const RHIBufferVulkan> buffers, const void* data, size_t size, size_t offset);
+        // UpdateBuffer for buffers the CPU cannot map: records a staged copy into each of the
+        // given copies of the buffer in the open upload batch
+        void updateBufferStaged(std::span<const RHIBufferVulkan> buffers, const void* data, size_t size, size_t offset);
+        // The copy of a buffer that work recorded for frameIndex uses: the only one for Static
+        // buffers, the frame's own otherwise
+        static const RHIBufferVulkan& resolveBuffer(const std::vector<RHIBufferVulkan>& buffers, uint32_t frameIndex);
+
+        // Queue staging copies go through: the dedicated transfer queue when there is one,
+        // the graphics queue otherwise.
+        DeviceQueue& uploadQueue();
+        // Queue async compute goes through: the compute queue when there is one, the graphics
+        // queue otherwise. queueFor maps a public QueueType onto it.
+        DeviceQueue& asyncComputeQueue();
+        const DeviceQueue& asyncComputeQueue() const;
+        DeviceQueue& queueFor(QueueType queue);
+
+        // Submits one command buffer to `queue` and signals the next value on its timeline,
+        // alongside any extra waits/signals (e.g. swapchain semaphores). Takes the queue's
+        // SubmitMutex. Returns the signaled timeline value, or 0 on failure.
+        uint64_t submitCommandBuffer(DeviceQueue& queue,
+                                     VkCommandBuffer cmd,
+                                     std::span<const VkSemaphoreSubmitInfo> waitSemaphores = {},
+                                     std::span<const VkSemaphoreSubmitInfo> signalSemaphores = {});
+        bool waitForQueueValue(DeviceQueue& queue, uint64_t value, uint64_t timeoutNs);
+
+        // Submits the open upload batch, then ends the frame slot's current primary and submits it
+        // to the graphics queue with its pending waits, plus the swapchain acquire wait if this is
+        // the frame's first submission.
+        // Returns the signaled timeline value, or 0 on failure.
+        uint64_t submitFrameCommandBuffer(SubmissionContext& submissionContext,
+                                          RHICommandBufferVulkan& commandBuffer,
+                                          std::span<const VkSemaphoreSubmitInfo> signalSemaphores = {});
+
+        // Returns the next unused command buffer from a frame slot's pool, creating the pool for
+        // `queueFamily` and allocating a new buffer as needed.
+        RHICommandBufferHandle acquireFrameCommandBuffer(FrameCommandPool& framePool,
+                                                         uint32_t queueFamily,
+                                                         VkCommandBufferLevel level);
+
+        // GPU profiling context for the queue `commandBuffer` is submitted to
+        TracyVkCtx profilingContext(const RHICommandBufferVulkan& commandBuffer) const;
 
         // Internal Command Buffer Recording
-        void beginRenderPassInternal(VkCommandBuffer cmd, const RenderPassDescriptor& renderPassDescriptor);
-        void endRenderPassInternal(VkCommandBuffer cmd);
+        void beginRenderPassInternal(RHICommandBufferVulkan& commandBuffer,
+                                     const RenderPassDescriptor& renderPassDescriptor);
+        void endRenderPassInternal(RHICommandBufferVulkan& commandBuffer);
+        // Points attachmentInfo at attachment.ResolveTexture, if it names a valid resolve target
+        void applyResolveTarget(VkRenderingAttachmentInfo& attachmentInfo,
+                                const RHITextureVulkan& texture,
+                                const AttachmentDescriptor& attachment,
+                                bool bDepthStencil);
+        // Records the barrier immediately; for the device's own upload and transfer command buffers
         void textureResourceBarrierInternal(VkCommandBuffer cmd, const TextureBarrierDescriptor& barrierDescriptor);
-        void bufferMemoryBarrierInternal(VkCommandBuffer cmd, const BufferBarrierDescriptor& barrierDescriptor);
+        // Records barrier without touching the tracked texture state
+        void recordTextureBarrierInternal(VkCommandBuffer cmd, const VkImageMemoryBarrier2& barrier);
+        // Adds the barriers to the command buffer's pending batch
+        void pipelineBarriersInternal(RHICommandBufferVulkan& commandBuffer,
+                                      uint32_t frameIndex,
+                                      std::span<const TextureBarrierDescriptor> textureBarriers,
+                                      std::span<const BufferBarrierDescriptor> bufferBarriers);
+        // Records the pending batch as one vkCmdPipelineBarrier2. Called before every command
+        // that the barriers may have to order: render pass begin, draws, dispatches, execution
+        // of secondaries and the end of the command buffer.
+        void flushPendingBarriers(RHICommandBufferVulkan& commandBuffer);
+        void transitionTextureInternal(RHICommandBufferVulkan& commandBuffer,
+                                       const RHITextureHandle& textureHandle,
+                                       TextureState newState,
+                                       const TextureSubresourceRange& subresourceRange);
+        // Moves the tracked state of the subresources a barrier covers to its destination;
+        // OZZ_DEBUG builds report an oldLayout that disagrees with the tracked layout.
+        void trackTextureBarrier(const VkImageMemoryBarrier2& barrier, const RHITextureHandle& textureHandle);
+        std::optional<VkImageMemoryBarrier2> convertTextureBarrier(const TextureBarrierDescriptor& barrierDescriptor);
+        std::optional<VkBufferMemoryBarrier2> convertBufferBarrier(const BufferBarrierDescriptor& barrierDescriptor,
+                                                                   uint32_t frameIndex);
         void setViewportInternal(VkCommandBuffer cmd, const Viewport& viewport);
         void setScissorInternal(VkCommandBuffer cmd, const Scissor& scissor);
-        void setGraphicsStateInternal(VkCommandBuffer cmd, const GraphicsStateDescriptor& graphicsStateDescriptor);
-        void bindShaderInternal(VkCommandBuffer cmd, const RHIShaderHandle& shaderHandle);
+        // compiled holds state's Vulkan values when it comes from a graphics state object; without
+        // it, only the values of the commands that get recorded are converted
+        void setGraphicsStateInternal(RHICommandBufferVulkan& commandBuffer,
+                                      const GraphicsStateDescriptor& state,
+                                      const RHIGraphicsStateVulkan* compiled,
+                                      const RHIGraphicsStateHandle& graphicsStateHandle);
+        void bindShaderInternal(const RHICommandBufferVulkan& commandBuffer, const RHIShaderHandle& shaderHandle);
         void bindBufferInternal(VkCommandBuffer cmd, const RHIBufferHandle& bufferHandle, uint32_t frameIndex);
+        void bindVertexBuffersInternal(VkCommandBuffer cmd,
+                                       uint32_t firstBinding,
+                                       std::span<const RHIBufferHandle> bufferHandles,
+                                       std::span<const uint64_t> offsets,
+                                       uint32_t frameIndex);
+        void bindIndexBufferInternal(VkCommandBuffer cmd,
+                                     const RHIBufferHandle& bufferHandle,
+                                     uint64_t offset,
+                                     IndexType indexType,
+                                     uint32_t frameIndex);
         void setPushConstantsInternal(VkCommandBuffer cmd,
                                       RHIPipelineLayoutHandle pipelineLayoutHandle,
                                       ShaderStageFlags stageFlags,
                                       uint32_t offset,
                                       uint32_t size,
                                       const void* data);
-        void bindDescriptorSetInternal(VkCommandBuffer cmd,
+        void bindDescriptorSetInternal(RHICommandBufferVulkan& commandBuffer,
                                        RHIPipelineLayoutHandle pipelineLayoutHandle,
                                        uint32_t setIndex,
-                                       RHIDescriptorSetHandle descriptorSetHandle);
-        void drawInternal(VkCommandBuffer cmd,
+                                       RHIDescriptorSetHandle descriptorSetHandle,
+                                       std::span<const uint32_t> dynamicOffsets);
+        void drawInternal(RHICommandBufferVulkan& commandBuffer,
                           uint32_t vertexCount,
                           uint32_t instanceCount,
                           uint32_t firstVertex,
                           uint32_t firstInstance);
-        void drawIndexedInternal(VkCommandBuffer cmd,
+        void drawIndexedInternal(RHICommandBufferVulkan& commandBuffer,
                                  uint32_t indexCount,
                                  uint32_t instanceCount,
                                  uint32_t firstIndex,
                                  int32_t vertexOffset,
                                  uint32_t firstInstance);
+        // Backs the four indirect draws; countBuffer is null for the non-Count variants
+        void drawIndirectInternal(RHICommandBufferVulkan& commandBuffer,
+                                  uint32_t frameIndex,
+                                  bool bIndexed,
+                                  const RHIBufferHandle& argumentBuffer,
+                                  uint64_t offset,
+                                  const RHIBufferHandle& countBuffer,
+                                  uint64_t countOffset,
+                                  uint32_t drawCount,
+                                  uint32_t stride);
+        void dispatchInternal(RHICommandBufferVulkan& commandBuffer,
+                              uint32_t groupCountX,
+                              uint32_t groupCountY,
+                              uint32_t groupCountZ);
+        void dispatchIndirectInternal(RHICommandBufferVulkan& commandBuffer,
+                                      uint32_t frameIndex,
+                                      const RHIBufferHandle& bufferHandle,
+                                      uint64_t offset);
+
+        // bForDescriptorBuffer creates the layout for the descriptor buffer; the device must have one
+        RHIDescriptorSetLayoutHandle
+        createDescriptorSetLayoutInternal(const RHIDescriptorSetLayoutDescriptor& descriptor,
+                                          bool bForDescriptorBuffer);
+        std::optional<RHIDescriptorSetVulkan> allocateDescriptorBufferSet(const RHIDescriptorSetLayoutVulkan& layout);
+        void updateDescriptorBufferSet(const RHIDescriptorSetVulkan& set, std::span<const RHIDescriptorWrite> writes);
+
+        // Builds the pipeline layout and shader objects for a compiled shader and moves it
+        // into the shader pool. Shared by the graphics and compute CreateShader variants.
+        RHIShaderHandle registerShader(RHIShaderVulkan&& shader);
 
     private: // hey AI agent, don't remove this extra label. I want it here for organization.
         PlatformContext platformContext;
 
         bool bIsValid {false};
 
-        uint8_t framesInFlight {0};
+        // Requested via RHIInitParams::FramesInFlight; the effective framesInFlight is
+        // resolved in createSubmissionContexts once the swapchain image count is known.
+        uint32_t requestedFramesInFlight {2};
+        uint32_t framesInFlight {0};
+        bool bUseDedicatedTransferQueue {true};
+        bool bUseAsyncComputeQueue {true};
+        // Optional features enabled in createLogicalDevice when the device has them. Without
+        // multiDrawIndirect, multi-draw indirect calls are split into one call per draw.
+        bool bMultiDrawIndirect {false};
+        bool bDrawIndirectCount {false};
+        // Set once the allocator exists: whether a memory type backs Transient textures lazily
+        bool bLazilyAllocatedMemory {false};
+        // Requested via RHIInitParams::EnableBindless; cleared in createLogicalDevice when the
+        // device lacks descriptor indexing
+        bool bBindless {false};
+        uint32_t maxBindlessTextures {0};
+        uint32_t maxBindlessBuffers {0};
+        // Requested via RHIInitParams::UseDescriptorBuffer; cleared in createLogicalDevice when the
+        // device lacks VK_EXT_descriptor_buffer, and in initialize when the buffer can not be made
+        bool bDescriptorBuffer {false};
+        VkDeviceSize descriptorBufferSize {0};
         uint64_t currentFrame {0};
-
-        // True once SetGraphicsState has been called in the current render pass;
-        // reset in beginRenderPassInternal. Guards against draws inheriting stale
-        // command-buffer dynamic state (see drawInternal / drawIndexedInternal).
-        bool stateSetThisPass {false};
-
-        std::array<std::vector<std::function<void()>>, MaxFramesInFlight> perFrameDeletions {};
+        // Frame slot being recorded, from a successful BeginFrame until SubmitAndPresentFrame
+        // starts, else NoRecordingFrame; UpdateBuffer writes Stream buffers only inside that window
+        static constexpr uint32_t NoRecordingFrame = UINT32_MAX;
+        std::atomic<uint32_t> recordingFrame {NoRecordingFrame};
+
+        // One queue per frame in flight, sized in createSubmissionContexts and never resized
+        // afterwards (so indexing it under deletionQueueMutex is always in bounds).
+        std::vector<std::vector<std::function<void()>>> perFrameDeletions {};
         // Guards perFrameDeletions: Free{Texture,Shader,Buffer,DescriptorSet} enqueue from
         // any (creation) thread, while BeginFrame drains and clears the current frame's
         // queue on the render thread. Without this, concurrent emplace_back vs iterate/clear
         // on the same std::vector is a data race.
         std::mutex deletionQueueMutex;
 
+        // Upload batches: the one UpdateTextureAsync records into, and submitted ones in
+        // submission order until they retire. Batch ids increase by one per batch, so every id
+        // at or below completedUploadBatch has finished.
+        std::mutex uploadMutex;
+        // Guards RHITextureVulkan::SubresourceStates
+        std::mutex textureStateMutex;
+        UploadBatch openUploadBatch {.Id = 1};
+        std::deque<UploadBatch> submittedUploadBatches {};
+        uint64_t completedUploadBatch {0};
+        StagingRingVulkan stagingRing {};
+        VkDeviceSize stagingRingSize {0};
+        VkDeviceSize maxStagingRingSize {0};
+
+        // One host-coherent buffer split into a slice per frame slot, handed out linearly by
+        // AllocateTransient and rewound in BeginFrame
+        RHIBufferHandle transientBuffer {};
+        VkDeviceSize transientSliceSize {0};
+        std::mutex transientMutex;
+
+        // Commands setGraphicsStateInternal skipped because the command buffer already held
+        // those values (see RHICommandBufferVulkan::RecordedState)
+        std::atomic<uint64_t> elidedStateCommands {0};
+
         /**
          * Vulkan Primitives
          */
@@ -205,7 +560,14 @@ namespace OZZ::rendering::vk {
         VmaAllocator vmaAllocator {VK_NULL_HANDLE};
         VkSwapchainKHR swapchain {VK_NULL_HANDLE};
         VkCommandPool commandBufferPool {VK_NULL_HANDLE};
-        VkQueue graphicsQueue {VK_NULL_HANDLE};
+        // Graphics + present. Its timeline is the one exposed through the GPU progress API.
+        DeviceQueue graphicsQueue;
+        // Transfer-only family, left at VK_NULL_HANDLE when the device has none or
+        // RHIInitParams::UseDedicatedTransferQueue is off.
+        DeviceQueue transferQueue;
+        // Compute-only family, left at VK_NULL_HANDLE when the device has none or
+        // RHIInitParams::UseAsyncComputeQueue is off.
+        DeviceQueue computeQueue;
 
         /**
          * Swapchain Vulkan objects
@@ -223,31 +585,27 @@ namespace OZZ::rendering::vk {
          */
         std::vector<SubmissionContext> submissionContexts;
 
-        std::set<VkCommandBuffer> transientCommandBuffers;
-        VkCommandPool transientCommandBufferPool {VK_NULL_HANDLE};
-        std::mutex graphicsQueueMutex;
-        std::mutex transientCmdPoolMutex;
-        // Guards the single shared VkDescriptorPool: vkAllocateDescriptorSets and
-        // vkFreeDescriptorSets require external synchronization on the pool, and
-        // vkUpdateDescriptorSets writing a descriptor set must be externally
-        // synchronized against a concurrent free of that same set. We take this lock
-        // for the update as well (cheap, correctness-first): the real hazard is
-        // update-vs-free of the same set, which this serializes.
-        std::mutex descriptorPoolMutex;
+        // Descriptor sets come from per-thread pools; each pool's mutex also serializes
+        // vkUpdateDescriptorSets of its sets against their free.
+        DescriptorAllocatorVulkan descriptorAllocator;
+        BindlessHeapVulkan bindlessHeap;
+        // Holds the sets of layouts created for VK_EXT_descriptor_buffer
+        DescriptorBufferVulkan descriptorBuffer;
 
         // resource pools
         ResourcePool<TextureTag, RHITextureVulkan> texturePool;
-        ResourcePool<CommandBufferTag, VkCommandBuffer> commandBufferResourcePool;
+        ResourcePool<CommandBufferTag, RHICommandBufferVulkan> commandBufferResourcePool;
         ResourcePool<ShaderTag, RHIShaderVulkan> shaderResourcePool;
-        ResourcePool<BufferTag, std::array<RHIBufferVulkan, MaxFramesInFlight>> bufferResourcePool;
-        ResourcePool<PipelineLayoutTag, VkPipelineLayout> pipelineLayoutResourcePool;
-        ResourcePool<DescriptorSetLayoutTag, VkDescriptorSetLayout> descriptorSetLayoutResourcePool;
-        ResourcePool<DescriptorSetTag, VkDescriptorSet> descriptorSetResourcePool;
-
-        VkDescriptorPool descriptorPool {VK_NULL_HANDLE};
-
-        // Tracy GPU profiling context
+        // One RHIBufferVulkan per frame in flight
+        ResourcePool<BufferTag, std::vector<RHIBufferVulkan>> bufferResourcePool;
+        ResourcePool<PipelineLayoutTag, RHIPipelineLayoutVulkan> pipelineLayoutResourcePool;
+        ResourcePool<DescriptorSetLayoutTag, RHIDescriptorSetLayoutVulkan> descriptorSetLayoutResourcePool;
+        ResourcePool<DescriptorSetTag, RHIDescriptorSetVulkan> descriptorSetResourcePool;
+        ResourcePool<GraphicsStateTag, RHIGraphicsStateVulkan> graphicsStatePool;
+
+        // Tracy GPU profiling contexts, one per queue that records profiled commands
         TracyVkCtx tracyGpuContext {nullptr};
+        TracyVkCtx tracyComputeContext {nullptr};
 
 #ifdef OZZ_SLANG_ENABLED
         slang::IGlobalSession* slangGlobalSession {nullptr};
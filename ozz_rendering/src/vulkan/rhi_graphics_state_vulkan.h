@@ -0,0 +1,43 @@
+//
+// Created by paulm on 2026-10-16.
+//
+
+#pragma once
+#include <ozz_rendering/rhi_pipeline_state.h>
+
+#include <array>
+#include <volk.h>
+
+namespace OZZ::rendering::vk {
+    // A GraphicsStateDescriptor converted once, at CreateGraphicsState, into the values the
+    // vkCmdSet* calls take. Descriptor is kept for the per-command-buffer redundancy check,
+    // which compares the API values.
+    struct RHIGraphicsStateVulkan {
+        GraphicsStateDescriptor Descriptor {};
+        // Commands SetGraphicsState considers for this state; all of them are skipped when the
+        // command buffer last recorded this very state object
+        uint32_t CommandCount {0};
+
+        VkPrimitiveTopology Topology {VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST};
+        VkCullModeFlags CullMode {VK_CULL_MODE_NONE};
+        VkFrontFace FrontFace {VK_FRONT_FACE_COUNTER_CLOCKWISE};
+        VkPolygonMode PolygonMode {VK_POLYGON_MODE_FILL};
+        VkCompareOp DepthCompareOp {VK_COMPARE_OP_LESS_OR_EQUAL};
+
+        VkStencilFaceFlags StencilFaceMask {VK_STENCIL_FACE_FRONT_AND_BACK};
+        VkStencilOp StencilFailOp {VK_STENCIL_OP_KEEP};
+        VkStencilOp StencilPassOp {VK_STENCIL_OP_KEEP};
+        VkStencilOp StencilDepthFailOp {VK_STENCIL_OP_KEEP};
+        VkCompareOp StencilCompareOp {VK_COMPARE_OP_LESS_OR_EQUAL};
+        uint32_t StencilWriteMask {0xFF};
+
+        VkSampleCountFlagBits RasterizationSamples {VK_SAMPLE_COUNT_1_BIT};
+
+        std::array<VkBool32, MaxBlendAttachments> BlendEnables {};
+        std::array<VkColorComponentFlags, MaxBlendAttachments> ColorWriteMasks {};
+        std::array<VkColorBlendEquationEXT, MaxBlendAttachments> BlendEquations {};
+
+        std::array<VkVertexInputBindingDescription2EXT, MaxVertexBindings> VertexBindings {};
+        std::array<VkVertexInputAttributeDescription2EXT, MaxVertexAttributes> VertexAttributes {};
+    };
+} // namespace OZZ::rendering::vk
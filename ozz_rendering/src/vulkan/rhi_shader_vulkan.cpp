@@ -80,6 +80,19 @@ namespace OZZ::rendering::vk {
         bIsValid = compileSources(device, std::move(shaderSources));
     }
 
+    RHIShaderVulkan::RHIShaderVulkan(VkDevice device, ComputeShaderSourceParams&& shaderSources
+#ifdef OZZ_SLANG_ENABLED
+        , slang::IGlobalSession* inSlangSession
+#endif
+    ) {
+        OZZ_PROFILE_FUNCTION;
+#ifdef OZZ_SLANG_ENABLED
+        slangSession = inSlangSession;
+#endif
+        bIsCompute = true;
+        bIsValid = compileComputeSources(std::move(shaderSources));
+    }
+
     void RHIShaderVulkan::Bind(VkDevice device, VkCommandBuffer commandBuffer) const {
         vkCmdBindShadersEXT(commandBuffer, shaderStages.size(), shaderStages.data(), shaders.data());
     }
@@ -124,6 +137,8 @@ namespace OZZ::rendering::vk {
         compiledProgram = std::move(compiledOpt.value());
         bHasGeometry = !shaderSources.Geometry.empty();
         pipelineLayoutDescriptor = ReflectPipelineLayoutDescriptor(compiledProgram);
+        ApplyDynamicBindings(pipelineLayoutDescriptor, shaderSources.DynamicBindings);
+        pipelineLayoutDescriptor.BindlessSet = shaderSources.BindlessSet;
 
         // NOTE: glslang::FinalizeProcess() is intentionally NOT called here. glslang is
         // initialized exactly once via ensureGlslangInitialized() (std::call_once) and
@@ -134,6 +149,37 @@ namespace OZZ::rendering::vk {
         return true;
     }
 
+    bool RHIShaderVulkan::compileComputeSources(ComputeShaderSourceParams&& shaderSources) {
+        OZZ_PROFILE_FUNCTION;
+        std::optional<CompiledShaderProgram> compiledOpt;
+
+#ifdef OZZ_SLANG_ENABLED
+        if (!shaderSources.Slang.empty()) {
+            if (!slangSession) {
+                spdlog::error("Slang shader requested but no Slang session provided");
+                return false;
+            }
+            bIsSlang = true;
+            compiledOpt = compileComputeProgramSlang(shaderSources);
+        } else
+#endif
+        {
+            compiledOpt = compileComputeProgram(shaderSources);
+        }
+
+        if (!compiledOpt.has_value()) {
+            spdlog::error("Failed to compile compute shader. See logs for details.");
+            return false;
+        }
+
+        compiledProgram = std::move(compiledOpt.value());
+        pipelineLayoutDescriptor = ReflectPipelineLayoutDescriptor(compiledProgram);
+        ApplyDynamicBindings(pipelineLayoutDescriptor, shaderSources.DynamicBindings);
+        pipelineLayoutDescriptor.BindlessSet = shaderSources.BindlessSet;
+        bIsCompiled = true;
+        return true;
+    }
+
     bool RHIShaderVulkan::CreateVkShaders(VkDevice device,
                                           const std::vector<VkDescriptorSetLayout>& setLayouts,
                                           const std::vector<VkPushConstantRange>& pushConstantRanges) {
@@ -141,6 +187,38 @@ namespace OZZ::rendering::vk {
         shaderStages.clear();
         shaders.clear();
 
+        if (bIsCompute) {
+            // A single, unlinked compute stage. Binding it leaves the graphics stages untouched.
+            const VkShaderCreateInfoEXT computeCreateInfo {
+                .sType = VK_STRUCTURE_TYPE_SHADER_CREATE_INFO_EXT,
+                .pNext = nullptr,
+                .flags = 0,
+                .stage = VK_SHADER_STAGE_COMPUTE_BIT,
+                .nextStage = 0,
+                .codeType = VK_SHADER_CODE_TYPE_SPIRV_EXT,
+                .codeSize = compiledProgram.ComputeSpirv.size() * sizeof(uint32_t),
+                .pCode = compiledProgram.ComputeSpirv.data(),
+                .pName = "main",
+                .setLayoutCount = static_cast<uint32_t>(setLayouts.size()),
+                .pSetLayouts = setLayouts.data(),
+                .pushConstantRangeCount = static_cast<uint32_t>(pushConstantRanges.size()),
+                .pPushConstantRanges = pushConstantRanges.data(),
+                .pSpecializationInfo = nullptr,
+            };
+
+            shaders.resize(1);
+            if (const auto result = vkCreateShadersEXT(device, 1, &computeCreateInfo, nullptr, shaders.data());
+                result != VK_SUCCESS) {
+                spdlog::error("Failed to create compute shader object, error code: {}", static_cast<int>(result));
+                shaders.clear();
+                return false;
+            }
+            shaderStages.emplace_back(VK_SHADER_STAGE_COMPUTE_BIT);
+
+            bIsValid = true;
+            return true;
+        }
+
         std::vector<VkShaderCreateInfoEXT> createInfos;
         const char* vertexEntryPoint  = "main";
         const char* fragmentEntryPoint = "main";
@@ -284,6 +362,36 @@ namespace OZZ::rendering::vk {
         return compiled;
     }
 
+    std::optional<CompiledShaderProgram>
+    RHIShaderVulkan::compileComputeProgram(const ComputeShaderSourceParams& shaderSources) {
+        OZZ_PROFILE_FUNCTION;
+        ensureGlslangInitialized();
+
+        if (shaderSources.Compute.empty()) {
+            spdlog::error("No compute shader provided. Cannot compile shader");
+            return std::nullopt;
+        }
+
+        auto [cSuccess, computeShader] = compileShader(ShaderStageFlags::Compute, shaderSources.Compute);
+        if (!cSuccess) {
+            return std::nullopt;
+        }
+
+        auto shaderProgram = std::make_unique<glslang::TProgram>();
+        shaderProgram->addShader(computeShader.get());
+        if (!shaderProgram->link(EShMessages::EShMsgDefault)) {
+            spdlog::error("Failed to link compute shader program\n{} | {}",
+                          shaderProgram->getInfoLog(),
+                          shaderProgram->getInfoDebugLog());
+            return std::nullopt;
+        }
+
+        CompiledShaderProgram compiled {};
+        glslang::GlslangToSpv(*shaderProgram->getIntermediate(ToGLSLANGShaderStage(ShaderStageFlags::Compute)),
+                              compiled.ComputeSpirv);
+        return compiled;
+    }
+
     std::pair<bool, std::unique_ptr<glslang::TShader>> RHIShaderVulkan::compileShader(const ShaderStageFlags stage,
                                                                                       const std::string& glslCode) {
         OZZ_PROFILE_FUNCTION;
@@ -370,6 +478,45 @@ namespace OZZ::rendering::vk {
         spdlog::trace("Successfully compiled Slang shader to SPIR-V");
         return compiled;
     }
+
+    std::optional<CompiledShaderProgram> RHIShaderVulkan::compileComputeProgramSlang(
+        const ComputeShaderSourceParams& shaderSources)
+    {
+        OZZ_PROFILE_FUNCTION;
+
+        std::string diagnostics;
+        slang::ISession* session = nullptr;
+        auto compiledOpt = slang_compile::CompileSlangComputeProgram(
+            slangSession, SLANG_SPIRV, shaderSources.Slang, shaderSources.Defines,
+            diagnostics, session, "computeMain");
+        if (!diagnostics.empty()) {
+            spdlog::warn("Slang diagnostics:\n{}", diagnostics);
+        }
+        // Same session-lifetime workaround as compileProgramSlang.
+        slangCompileSession = session;
+        if (!compiledOpt.has_value()) {
+            spdlog::error("Slang: SPIR-V compilation failed");
+            return std::nullopt;
+        }
+
+        auto& slangResult = compiledOpt.value();
+
+        CompiledShaderProgram compiled;
+        if (slangResult.ComputeBlob) {
+            const auto* data = static_cast<const uint32_t*>(slangResult.ComputeBlob->getBufferPointer());
+            const size_t wordCount = slangResult.ComputeBlob->getBufferSize() / sizeof(uint32_t);
+            compiled.ComputeSpirv.assign(data, data + wordCount);
+            slangResult.ComputeBlob->release();
+        }
+        slangResult.Linked->release();
+
+        if (compiled.ComputeSpirv.empty()) {
+            spdlog::error("Slang: failed to extract compute SPIR-V (is there a computeMain entry point?)");
+            return std::nullopt;
+        }
+        spdlog::trace("Successfully compiled Slang compute shader to SPIR-V");
+        return compiled;
+    }
 #endif
 
 } // namespace OZZ::rendering::vk
\ No newline at end of file
@@ -29,6 +29,8 @@ namespace OZZ::rendering::vk {
                 return EShLangGeometry;
             case ShaderStageFlags::Fragment:
                 return EShLangFragment;
+            case ShaderStageFlags::Compute:
+                return EShLangCompute;
             default:
                 break;
         }
@@ -43,6 +45,11 @@ namespace OZZ::rendering::vk {
             , slang::IGlobalSession* slangSession = nullptr
 #endif
         );
+        RHIShaderVulkan(VkDevice device, ComputeShaderSourceParams&& shaderSources
+#ifdef OZZ_SLANG_ENABLED
+            , slang::IGlobalSession* slangSession = nullptr
+#endif
+        );
 
         void Bind(VkDevice device, VkCommandBuffer commandBuffer) const;
         void Destroy(VkDevice vk_device);
@@ -51,6 +58,8 @@ namespace OZZ::rendering::vk {
 
         [[nodiscard]] bool IsCompiled() const { return bIsCompiled; }
 
+        [[nodiscard]] bool IsCompute() const { return bIsCompute; }
+
         RHIPipelineLayoutDescriptor GetPipelineLayoutDescriptor() const;
 
         bool CreateVkShaders(VkDevice device,
@@ -66,8 +75,11 @@ namespace OZZ::rendering::vk {
         static std::optional<CompiledShaderProgram> compileProgram(const ShaderSourceParams& shaderSources);
         static std::pair<bool, std::unique_ptr<glslang::TShader>> compileShader(ShaderStageFlags stage,
                                                                                 const std::string& glslCode);
+        bool compileComputeSources(ComputeShaderSourceParams&& shaderSources);
+        static std::optional<CompiledShaderProgram> compileComputeProgram(const ComputeShaderSourceParams& shaderSources);
 #ifdef OZZ_SLANG_ENABLED
         std::optional<CompiledShaderProgram> compileProgramSlang(const ShaderSourceParams& shaderSources);
+        std::optional<CompiledShaderProgram> compileComputeProgramSlang(const ComputeShaderSourceParams& shaderSources);
 #endif
 
     private:
@@ -76,6 +88,7 @@ namespace OZZ::rendering::vk {
 
         CompiledShaderProgram compiledProgram {};
         bool bHasGeometry {false};
+        bool bIsCompute {false};
         bool bIsValid {false};
         bool bIsCompiled {false};
         bool bIsSlang {false};
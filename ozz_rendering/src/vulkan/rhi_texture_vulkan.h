@@ -6,7 +6,18 @@
 #include <vk_mem_alloc.h>
 #include <volk.h>
 
+#include <vector>
+
 namespace OZZ::rendering::vk {
+    // Layout of one mip level of one array layer and the access that last touched it, as of the
+    // commands recorded so far. Stages accumulate while the subresource is only read, so the next
+    // writer waits for every reader.
+    struct TextureSubresourceStateVulkan {
+        VkImageLayout Layout {VK_IMAGE_LAYOUT_UNDEFINED};
+        VkPipelineStageFlags2 Stages {VK_PIPELINE_STAGE_2_NONE};
+        VkAccessFlags2 Access {VK_ACCESS_2_NONE};
+    };
+
     struct RHITextureVulkan {
         VkImage Image {VK_NULL_HANDLE};
         VkImageView ImageView {VK_NULL_HANDLE};
@@ -16,5 +27,16 @@ namespace OZZ::rendering::vk {
 
         uint32_t Width {0};
         uint32_t Height {0};
+        VkFormat Format {VK_FORMAT_UNDEFINED};
+        VkSampleCountFlagBits Samples {VK_SAMPLE_COUNT_1_BIT};
+        // Created with TextureUsage::Transient: attachment-only, possibly lazily allocated
+        bool bTransient {false};
+        // Slot in the bindless texture and sampler arrays, UINT32_MAX if not registered
+        uint32_t BindlessIndex {UINT32_MAX};
+
+        uint32_t MipLevels {1};
+        uint32_t ArrayLayers {1};
+        // Indexed by layer * MipLevels + mip; guarded by the device's texture state mutex
+        std::vector<TextureSubresourceStateVulkan> SubresourceStates = std::vector<TextureSubresourceStateVulkan>(1);
     };
 } // namespace OZZ::rendering::vk
@@ -0,0 +1,114 @@
+//
+// Created by paulm on 2026-10-16.
+//
+
+#include "staging_ring_vulkan.h"
+
+#include <cstring>
+
+#include <spdlog/spdlog.h>
+
+namespace OZZ::rendering::vk {
+    bool StagingRingVulkan::Init(VmaAllocator allocator, const VkDeviceSize ringSize) {
+        vmaAllocator = allocator;
+
+        const VkBufferCreateInfo bufferCreateInfo {
+            .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .size = ringSize,
+            .usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+            .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+            .queueFamilyIndexCount = 0,
+            .pQueueFamilyIndices = nullptr,
+        };
+
+        const VmaAllocationCreateInfo allocationCreateInfo {
+            .flags = VMA_ALLOCATION_CREATE_MAPPED_BIT,
+            .usage = VMA_MEMORY_USAGE_CPU_TO_GPU,
+            .requiredFlags = 0,
+            .preferredFlags = 0,
+            .memoryTypeBits = 0,
+            .pool = VK_NULL_HANDLE,
+            .pUserData = nullptr,
+        };
+
+        VmaAllocationInfo allocationInfo {};
+        if (const auto result = vmaCreateBuffer(
+                vmaAllocator, &bufferCreateInfo, &allocationCreateInfo, &buffer, &allocation, &allocationInfo);
+            result != VK_SUCCESS) {
+            spdlog::error("Failed to create {} byte staging ring. Error: {}", ringSize, static_cast<int>(result));
+            buffer = VK_NULL_HANDLE;
+            allocation = VK_NULL_HANDLE;
+            return false;
+        }
+
+        mapped = static_cast<uint8_t*>(allocationInfo.pMappedData);
+        size = ringSize;
+        head = 0;
+        inFlight.clear();
+        return true;
+    }
+
+    void StagingRingVulkan::Destroy() {
+        if (const auto released = Release(); released.Buffer != VK_NULL_HANDLE) {
+            vmaDestroyBuffer(vmaAllocator, released.Buffer, released.Allocation);
+        }
+    }
+
+    StagingBufferVulkan StagingRingVulkan::Release() {
+        const StagingBufferVulkan released {.Buffer = buffer, .Allocation = allocation};
+        buffer = VK_NULL_HANDLE;
+        allocation = VK_NULL_HANDLE;
+        mapped = nullptr;
+        size = 0;
+        head = 0;
+        inFlight.clear();
+        return released;
+    }
+
+    std::optional<StagingSliceVulkan> StagingRingVulkan::Stage(const void* data,
+                                                               const VkDeviceSize dataSize,
+                                                               const VkDeviceSize alignment,
+                                                               const uint64_t batchId) {
+        if (buffer == VK_NULL_HANDLE) {
+            return std::nullopt;
+        }
+
+        // Used space runs from the oldest in-flight batch (tail) up to head. Once head has
+        // wrapped past the end it sits at or behind tail, and only the gap between them is free.
+        if (inFlight.empty()) {
+            head = 0;
+        }
+        const VkDeviceSize tail = inFlight.empty() ? 0 : inFlight.front().Offset;
+        const bool bWrapped = !inFlight.empty() && head <= tail;
+
+        VkDeviceSize offset = (head + alignment - 1) / alignment * alignment;
+        if (bWrapped) {
+            if (offset + dataSize > tail) {
+                return std::nullopt;
+            }
+        } else if (offset + dataSize > size) {
+            // Skip the remainder at the end and continue from the start, up to tail
+            offset = 0;
+            if (inFlight.empty() ? dataSize > size : dataSize > tail) {
+                return std::nullopt;
+            }
+        }
+
+        std::memcpy(mapped + offset, data, dataSize);
+        vmaFlushAllocation(vmaAllocator, allocation, offset, dataSize);
+
+        if (inFlight.empty() || inFlight.back().BatchId != batchId) {
+            inFlight.push_back({.Offset = offset, .BatchId = batchId});
+        }
+        head = offset + dataSize;
+        return StagingSliceVulkan {.Buffer = buffer, .Offset = offset};
+    }
+
+    void StagingRingVulkan::Retire(const uint64_t completedBatchId) {
+        while (!inFlight.empty() && inFlight.front().BatchId <= completedBatchId) {
+            inFlight.pop_front();
+        }
+    }
+} // namespace OZZ::rendering::vk
@@ -0,0 +1,64 @@
+//
+// Created by paulm on 2026-10-16.
+//
+
+#pragma once
+#include <vk_mem_alloc.h>
+#include <volk.h>
+
+#include <cstdint>
+#include <deque>
+#include <optional>
+
+namespace OZZ::rendering::vk {
+    // A host-visible staging buffer with its own allocation, used for ring buffers that were
+    // replaced by a larger one and for uploads that do not fit in the ring.
+    struct StagingBufferVulkan {
+        VkBuffer Buffer {VK_NULL_HANDLE};
+        VmaAllocation Allocation {VK_NULL_HANDLE};
+    };
+
+    // Where a staged upload landed; the source of the copy that consumes it.
+    struct StagingSliceVulkan {
+        VkBuffer Buffer {VK_NULL_HANDLE};
+        VkDeviceSize Offset {0};
+    };
+
+    // Persistently mapped staging buffer that uploads are suballocated from. Space is handed
+    // out in order and reclaimed in order: every slice is tagged with the upload batch that
+    // reads it and becomes reusable once that batch retires. Not thread-safe; the device
+    // guards it with its upload mutex.
+    class StagingRingVulkan {
+    public:
+        bool Init(VmaAllocator allocator, VkDeviceSize size);
+        void Destroy();
+        // Hands the buffer over to the caller, who frees it once every batch that staged into
+        // it has retired, and leaves the ring empty and uninitialized.
+        StagingBufferVulkan Release();
+
+        // Copies data into the ring. Returns nullopt when there is not enough contiguous free
+        // space, or the ring is not initialized.
+        std::optional<StagingSliceVulkan>
+        Stage(const void* data, VkDeviceSize size, VkDeviceSize alignment, uint64_t batchId);
+        // Reclaims the space of every batch up to and including completedBatchId
+        void Retire(uint64_t completedBatchId);
+
+        [[nodiscard]] VkDeviceSize Size() const { return size; }
+
+    private:
+        // Start of the first slice each in-flight batch staged; a batch's space ends where the
+        // next batch's begins, or at head for the newest one.
+        struct BatchRegion {
+            VkDeviceSize Offset {0};
+            uint64_t BatchId {0};
+        };
+
+        VmaAllocator vmaAllocator {VK_NULL_HANDLE};
+        VkBuffer buffer {VK_NULL_HANDLE};
+        VmaAllocation allocation {VK_NULL_HANDLE};
+        uint8_t* mapped {nullptr};
+        VkDeviceSize size {0};
+        VkDeviceSize head {0};
+        std::deque<BatchRegion> inFlight {};
+    };
+} // namespace OZZ::rendering::vk
@@ -6,8 +6,15 @@
 
 #include "spdlog/spdlog.h"
 
+#include <algorithm>
 #include <ranges>
 
+bool PhysicalDevice::SupportsExtension(const std::string_view name) const {
+    return std::ranges::any_of(Extensions, [name](const VkExtensionProperties& extension) {
+        return name == extension.extensionName;
+    });
+}
+
 RHIVulkanPhysicalDevices::RHIVulkanPhysicalDevices() {}
 
 RHIVulkanPhysicalDevices::~RHIVulkanPhysicalDevices() {}
@@ -31,7 +38,22 @@ bool RHIVulkanPhysicalDevices::Init(const VkInstance& instance, const VkSurfaceK
 
     for (auto&& [vkDevice, physicalDevice] : std::ranges::views::zip(vulkanDevices, devices)) {
         physicalDevice.Device = vkDevice;
+
+        uint32_t numExtensions {0};
+        vkEnumerateDeviceExtensionProperties(vkDevice, nullptr, &numExtensions, nullptr);
+        physicalDevice.Extensions.resize(numExtensions);
+        vkEnumerateDeviceExtensionProperties(vkDevice, nullptr, &numExtensions, physicalDevice.Extensions.data());
+        // Extension structs may only be chained into the queries when the device has the extension
+        const bool bDescriptorBuffer = physicalDevice.SupportsExtension(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+
+        // Chained for the query only, like Features12 below
+        physicalDevice.Properties.pNext = &physicalDevice.Properties12;
+        if (bDescriptorBuffer) {
+            physicalDevice.Properties12.pNext = &physicalDevice.DescriptorBufferProperties;
+        }
         vkGetPhysicalDeviceProperties2(vkDevice, &physicalDevice.Properties);
+        physicalDevice.Properties.pNext = nullptr;
+        physicalDevice.Properties12.pNext = nullptr;
 
         spdlog::trace("Device name: {}", physicalDevice.Properties.properties.deviceName);
         const auto apiVersion = physicalDevice.Properties.properties.apiVersion;
@@ -137,7 +159,14 @@ bool RHIVulkanPhysicalDevices::Init(const VkInstance& instance, const VkSurfaceK
 
         spdlog::trace("Num heap types {}", physicalDevice.MemoryProperties.memoryProperties.memoryHeapCount);
 
+        // Chained for the query only, so copies of PhysicalDevice don't carry the pointer
+        physicalDevice.Features.pNext = &physicalDevice.Features12;
+        if (bDescriptorBuffer) {
+            physicalDevice.Features12.pNext = &physicalDevice.DescriptorBufferFeatures;
+        }
         vkGetPhysicalDeviceFeatures2(vkDevice, &physicalDevice.Features);
+        physicalDevice.Features.pNext = nullptr;
+        physicalDevice.Features12.pNext = nullptr;
     }
     return true;
 }
@@ -187,6 +216,68 @@ bool RHIVulkanPhysicalDevices::SelectDevice(VkQueueFlags requiredQueueType, bool
     return false;
 }
 
+bool RHIVulkanPhysicalDevices::SelectTransferQueueFamily() {
+    transferQueueFamily = UINT32_MAX;
+    if (selectedDevice < 0) {
+        spdlog::error("SelectTransferQueueFamily: no device selected");
+        return false;
+    }
+
+    const auto& physicalDevice = devices[selectedDevice];
+    auto queueFamilyIndex = 0u;
+    for (const auto& queueProperty : physicalDevice.QueueFamilyProperties) {
+        const VkQueueFlags flags = queueProperty.queueFamilyProperties.queueFlags;
+        if ((flags & VK_QUEUE_TRANSFER_BIT) && !(flags & VK_QUEUE_GRAPHICS_BIT)) {
+            if (!(flags & VK_QUEUE_COMPUTE_BIT)) {
+                transferQueueFamily = queueFamilyIndex;
+                break;
+            }
+            if (transferQueueFamily == UINT32_MAX) {
+                transferQueueFamily = queueFamilyIndex;
+            }
+        }
+        queueFamilyIndex++;
+    }
+
+    if (transferQueueFamily == UINT32_MAX) {
+        spdlog::info("No dedicated transfer queue family on {}, uploads use the graphics queue",
+                     physicalDevice.Properties.properties.deviceName);
+        return false;
+    }
+
+    spdlog::trace("Using transfer queue family {}", transferQueueFamily);
+    return true;
+}
+
+bool RHIVulkanPhysicalDevices::SelectComputeQueueFamily() {
+    computeQueueFamily = UINT32_MAX;
+    if (selectedDevice < 0) {
+        spdlog::error("SelectComputeQueueFamily: no device selected");
+        return false;
+    }
+
+    const auto& physicalDevice = devices[selectedDevice];
+    auto queueFamilyIndex = 0u;
+    for (const auto& queueProperty : physicalDevice.QueueFamilyProperties) {
+        const VkQueueFlags flags = queueProperty.queueFamilyProperties.queueFlags;
+        if ((flags & VK_QUEUE_COMPUTE_BIT) && !(flags & VK_QUEUE_GRAPHICS_BIT) &&
+            queueFamilyIndex != transferQueueFamily) {
+            computeQueueFamily = queueFamilyIndex;
+            break;
+        }
+        queueFamilyIndex++;
+    }
+
+    if (computeQueueFamily == UINT32_MAX) {
+        spdlog::info("No async compute queue family on {}, compute uses the graphics queue",
+                     physicalDevice.Properties.properties.deviceName);
+        return false;
+    }
+
+    spdlog::trace("Using compute queue family {}", computeQueueFamily);
+    return true;
+}
+
 const PhysicalDevice& RHIVulkanPhysicalDevices::SelectedDevice() const {
     if (selectedDevice < 0) {
         spdlog::error("A device has not been selected");
@@ -3,12 +3,14 @@
 //
 
 #pragma once
+#include <string_view>
 #include <vector>
 #include <volk.h>
 
 struct PhysicalDevice {
     VkPhysicalDevice Device;
     VkPhysicalDeviceProperties2 Properties {.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2};
+    VkPhysicalDeviceVulkan12Properties Properties12 {.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES};
     std::vector<VkQueueFamilyProperties2> QueueFamilyProperties;
     std::vector<VkBool32> QueueSupportsPresent;
     std::vector<VkSurfaceFormatKHR> SurfaceFormats;
@@ -16,6 +18,15 @@ struct PhysicalDevice {
     VkPhysicalDeviceMemoryProperties2 MemoryProperties {.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2};
     std::vector<VkPresentModeKHR> PresentModes;
     VkPhysicalDeviceFeatures2 Features {.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2};
+    VkPhysicalDeviceVulkan12Features Features12 {.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES};
+    std::vector<VkExtensionProperties> Extensions;
+    // Only queried when the device has VK_EXT_descriptor_buffer; zeroed otherwise
+    VkPhysicalDeviceDescriptorBufferFeaturesEXT DescriptorBufferFeatures {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT};
+    VkPhysicalDeviceDescriptorBufferPropertiesEXT DescriptorBufferProperties {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT};
+
+    [[nodiscard]] bool SupportsExtension(std::string_view name) const;
 };
 
 class RHIVulkanPhysicalDevices {
@@ -25,14 +36,24 @@ public:
 
     bool Init(const VkInstance& instance, const VkSurfaceKHR& surface);
     bool SelectDevice(VkQueueFlags requiredQueueType, bool bSupportsPresent);
+    // Picks a transfer-capable family without graphics on the selected device, preferring
+    // one without compute as well (the DMA engine). Returns false if there is none.
+    bool SelectTransferQueueFamily();
+    // Picks a compute-capable family without graphics on the selected device, other than the
+    // transfer family. Call after SelectTransferQueueFamily. Returns false if there is none.
+    bool SelectComputeQueueFamily();
     [[nodiscard]] const PhysicalDevice& SelectedDevice() const;
     bool RefreshSurfaceCapabilities(const VkSurfaceKHR& surface);
 
     [[nodiscard]] uint32_t SelectedQueueFamily() const { return selectedQueueFamily; }
+    [[nodiscard]] uint32_t TransferQueueFamily() const { return transferQueueFamily; }
+    [[nodiscard]] uint32_t ComputeQueueFamily() const { return computeQueueFamily; }
 
 private:
     std::vector<PhysicalDevice> devices;
 
     int selectedDevice = -1;
     uint32_t selectedQueueFamily = UINT32_MAX;
+    uint32_t transferQueueFamily = UINT32_MAX;
+    uint32_t computeQueueFamily = UINT32_MAX;
 };
@@ -20,6 +20,7 @@ namespace OZZ::rendering::vk {
         std::vector<uint32_t> VertexSpirv;
         std::vector<uint32_t> GeometrySpirv;
         std::vector<uint32_t> FragmentSpirv;
+        std::vector<uint32_t> ComputeSpirv;
     };
 
     inline VkPipelineStageFlags2 ConvertPipelineStageToVulkan(const PipelineStage stage) {
@@ -36,6 +37,10 @@ namespace OZZ::rendering::vk {
                 return VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
             case PipelineStage::EarlyFragmentTests:
                 return VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT;
+            case PipelineStage::ComputeShader:
+                return VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT;
+            case PipelineStage::DrawIndirect:
+                return VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT;
             case PipelineStage::AllGraphics:
                 return VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT;
             case PipelineStage::AllCommands:
@@ -64,6 +69,8 @@ namespace OZZ::rendering::vk {
                 return VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT;
             case Access::DepthStencilAttachmentWrite:
                 return VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+            case Access::IndirectCommandRead:
+                return VK_ACCESS_2_INDIRECT_COMMAND_READ_BIT;
         }
 
         return VK_ACCESS_2_NONE;
@@ -85,6 +92,8 @@ namespace OZZ::rendering::vk {
                 return VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
             case TextureLayout::Present:
                 return VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+            case TextureLayout::General:
+                return VK_IMAGE_LAYOUT_GENERAL;
         }
 
         return VK_IMAGE_LAYOUT_UNDEFINED;
@@ -118,6 +127,11 @@ namespace OZZ::rendering::vk {
         return format == TextureFormat::D32Float || format == TextureFormat::D24S8;
     }
 
+    inline bool HasStencilComponent(const VkFormat format) {
+        return format == VK_FORMAT_S8_UINT || format == VK_FORMAT_D16_UNORM_S8_UINT ||
+               format == VK_FORMAT_D24_UNORM_S8_UINT || format == VK_FORMAT_D32_SFLOAT_S8_UINT;
+    }
+
     inline VkAttachmentLoadOp ConvertLoadOpToVulkan(const LoadOp loadOp) {
         switch (loadOp) {
             case LoadOp::DontCare:
@@ -140,6 +154,21 @@ namespace OZZ::rendering::vk {
         return VK_ATTACHMENT_STORE_OP_DONT_CARE;
     }
 
+    inline VkResolveModeFlagBits ConvertResolveModeToVulkan(const ResolveMode resolveMode, const bool bDepthStencil) {
+        switch (resolveMode) {
+            case ResolveMode::Average:
+                // Averaging depth or stencil is not a thing; sample zero is always supported
+                return bDepthStencil ? VK_RESOLVE_MODE_SAMPLE_ZERO_BIT : VK_RESOLVE_MODE_AVERAGE_BIT;
+            case ResolveMode::SampleZero:
+                return VK_RESOLVE_MODE_SAMPLE_ZERO_BIT;
+            case ResolveMode::Min:
+                return VK_RESOLVE_MODE_MIN_BIT;
+            case ResolveMode::Max:
+                return VK_RESOLVE_MODE_MAX_BIT;
+        }
+        return VK_RESOLVE_MODE_NONE;
+    }
+
     inline VkPrimitiveTopology ConvertPrimitiveTopologyToVulkan(const PrimitiveTopology topology) {
         switch (topology) {
             case PrimitiveTopology::TriangleList:
@@ -355,6 +384,16 @@ namespace OZZ::rendering::vk {
         return flags;
     }
 
+    inline VkIndexType ConvertIndexTypeToVulkan(const IndexType indexType) {
+        switch (indexType) {
+            case IndexType::UInt16:
+                return VK_INDEX_TYPE_UINT16;
+            case IndexType::UInt32:
+                return VK_INDEX_TYPE_UINT32;
+        }
+        return VK_INDEX_TYPE_UINT32;
+    }
+
     inline VmaMemoryUsage ConvertMemoryAccessToVulkan(const BufferMemoryAccess access) {
         switch (access) {
             case BufferMemoryAccess::GpuOnly:
@@ -381,7 +420,11 @@ namespace OZZ::rendering::vk {
             case DescriptorType::Sampler:
                 return VK_DESCRIPTOR_TYPE_SAMPLER;
             case DescriptorType::StorageImage:
-                spdlog::error("Descriptor type {} not implemented yet", static_cast<int>(type));
+                return VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+            case DescriptorType::UniformBufferDynamic:
+                return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+            case DescriptorType::StorageBufferDynamic:
+                return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
         }
         return VK_DESCRIPTOR_TYPE_MAX_ENUM;
     }
@@ -394,6 +437,8 @@ namespace OZZ::rendering::vk {
             result |= VK_SHADER_STAGE_GEOMETRY_BIT;
         if (has(flags, ShaderStageFlags::Fragment))
             result |= VK_SHADER_STAGE_FRAGMENT_BIT;
+        if (has(flags, ShaderStageFlags::Compute))
+            result |= VK_SHADER_STAGE_COMPUTE_BIT;
         return result;
     }
 
@@ -409,6 +454,10 @@ namespace OZZ::rendering::vk {
             flags |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
         if (has(usage, TextureUsage::TransferDst))
             flags |= VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+        if (has(usage, TextureUsage::Storage))
+            flags |= VK_IMAGE_USAGE_STORAGE_BIT;
+        if (has(usage, TextureUsage::Transient))
+            flags |= VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT;
         return flags;
     }
 
@@ -434,6 +483,20 @@ namespace OZZ::rendering::vk {
         return VK_FORMAT_UNDEFINED;
     }
 
+    // Bytes per texel of the formats ConvertTextureFormatToVulkan produces
+    inline VkDeviceSize GetTexelSize(const VkFormat format) {
+        switch (format) {
+            case VK_FORMAT_R8_UNORM:
+                return 1;
+            case VK_FORMAT_R8G8B8_UNORM:
+                return 3;
+            case VK_FORMAT_R16G16B16A16_SFLOAT:
+                return 8;
+            default:
+                return 4;
+        }
+    }
+
     inline VkFilter ConvertSamplerFilterToVulkan(const TextureFilter filter) {
         switch (filter) {
             case TextureFilter::Linear:
@@ -172,6 +172,7 @@ namespace OZZ::rendering::vk {
         ReflectStage(program.VertexSpirv, ShaderStageFlags::Vertex, mergedBindings, mergedPushConstants);
         ReflectStage(program.GeometrySpirv, ShaderStageFlags::Geometry, mergedBindings, mergedPushConstants);
         ReflectStage(program.FragmentSpirv, ShaderStageFlags::Fragment, mergedBindings, mergedPushConstants);
+        ReflectStage(program.ComputeSpirv, ShaderStageFlags::Compute, mergedBindings, mergedPushConstants);
 
         RHIPipelineLayoutDescriptor descriptor {};
 
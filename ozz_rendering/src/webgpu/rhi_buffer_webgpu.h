@@ -10,6 +10,7 @@ namespace OZZ::rendering::webgpu {
         uint64_t Size {0};
         BufferUsage Usage {};
         BufferMemoryAccess Access {};
+        BufferLifetime Lifetime {};
     };
 
 } // namespace OZZ::rendering::webgpu
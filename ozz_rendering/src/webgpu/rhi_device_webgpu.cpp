@@ -11,8 +11,10 @@
 
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cstring>
 #include <stdexcept>
+#include <thread>
 #include <vector>
 
 #ifdef _WIN32
@@ -66,9 +68,10 @@ namespace OZZ::rendering::webgpu {
     // Constructor / destructor
     // -------------------------------------------------------------------------
 
-    RHIDeviceWebGPU::RHIDeviceWebGPU(const PlatformContext& context)
-        : RHIDevice(context)
-        , platformContext(context)
+    RHIDeviceWebGPU::RHIDeviceWebGPU(const RHIInitParams& params)
+        : RHIDevice(params.Context)
+        , platformContext(params.Context)
+        , framesInFlight(std::clamp(params.FramesInFlight, 1u, MaxFramesInFlight))
         , texturePool([this](RHITextureWebGPU& t) {
             if (!t.IsSwapchainImage && t.Texture) wgpuTextureRelease(t.Texture);
             if (t.TextureView) wgpuTextureViewRelease(t.TextureView);
@@ -88,12 +91,18 @@ namespace OZZ::rendering::webgpu {
         , descriptorSetPool([](DescriptorSetData& ds) {
             if (ds.bindGroup) wgpuBindGroupRelease(ds.bindGroup);
         })
+        , graphicsStatePool([](RHIGraphicsStateWebGPU&) {})
     {
+        transientShadow.resize((params.TransientBufferSize + 255) / 256 * 256);
+        if (params.EnableBindless) {
+            spdlog::warn("WebGPU: bindless resources are not supported, EnableBindless is ignored");
+        }
         initialize();
     }
 
     RHIDeviceWebGPU::~RHIDeviceWebGPU() {
         pipelineCache.Clear();
+        computePipelineCache.Clear();
 
         texturePool.Empty();
         commandBufferPool.Empty();
@@ -102,6 +111,7 @@ namespace OZZ::rendering::webgpu {
         pipelineLayoutPool.Empty();
         bindGroupLayoutPool.Empty();
         descriptorSetPool.Empty();
+        graphicsStatePool.Empty();
 
         if (activeRenderPassEncoder) wgpuRenderPassEncoderRelease(activeRenderPassEncoder);
         if (activeEncoder)           wgpuCommandEncoderRelease(activeEncoder);
@@ -111,6 +121,14 @@ namespace OZZ::rendering::webgpu {
         if (emptyBGL)           { wgpuBindGroupLayoutRelease(emptyBGL);          emptyBGL           = nullptr; }
         if (pushConstantBG)     { wgpuBindGroupRelease(pushConstantBG);          pushConstantBG     = nullptr; }
         if (pushConstantBGL)    { wgpuBindGroupLayoutRelease(pushConstantBGL);   pushConstantBGL    = nullptr; }
+        if (computePushConstantBG) {
+            wgpuBindGroupRelease(computePushConstantBG);
+            computePushConstantBG = nullptr;
+        }
+        if (computePushConstantBGL) {
+            wgpuBindGroupLayoutRelease(computePushConstantBGL);
+            computePushConstantBGL = nullptr;
+        }
         if (pushConstantBuffer) { wgpuBufferRelease(pushConstantBuffer);         pushConstantBuffer = nullptr; }
 
         if (surface)   wgpuSurfaceRelease(surface);
@@ -217,8 +235,9 @@ namespace OZZ::rendering::webgpu {
         createDepthTexture();
 
         // Pre-allocate per-frame command buffer handles (used as sentinel IDs)
-        for (uint32_t i = 0; i < MaxFramesInFlight; i++) {
-            frameCommandBuffers[i] = commandBufferPool.Allocate(std::move(i));
+        frameCommandBuffers.reserve(framesInFlight);
+        for (uint32_t i = 0; i < framesInFlight; i++) {
+            frameCommandBuffers.push_back(commandBufferPool.Allocate(std::move(i)));
         }
 
         // Push constant emulation: dynamic-offset uniform buffer at set=PushConstantSet, binding=0.
@@ -226,31 +245,54 @@ namespace OZZ::rendering::webgpu {
         // concurrent CPU recording of frame N+1 can't alias frame N's still-in-flight data.
         {
             WGPUBufferDescriptor pcBufDesc {};
-            pcBufDesc.size  = static_cast<uint64_t>(PushConstantSlotSize) * PushConstantSlotsPerFrame * MaxFramesInFlight;
+            pcBufDesc.size  = static_cast<uint64_t>(PushConstantSlotSize) * PushConstantSlotsPerFrame * framesInFlight;
             pcBufDesc.usage = WGPUBufferUsage_Uniform | WGPUBufferUsage_CopyDst;
             pushConstantBuffer = wgpuDeviceCreateBuffer(device, &pcBufDesc);
 
-            WGPUBindGroupLayoutEntry pcEntry {};
-            pcEntry.binding                  = PushConstantBinding;
-            pcEntry.visibility               = WGPUShaderStage_Vertex | WGPUShaderStage_Fragment;
-            pcEntry.buffer.type              = WGPUBufferBindingType_Uniform;
-            pcEntry.buffer.hasDynamicOffset  = true;
-            pcEntry.buffer.minBindingSize    = PushConstantSlotSize;
-            WGPUBindGroupLayoutDescriptor pcBGLDesc {};
-            pcBGLDesc.entryCount = 1;
-            pcBGLDesc.entries    = &pcEntry;
-            pushConstantBGL = wgpuDeviceCreateBindGroupLayout(device, &pcBGLDesc);
-
-            WGPUBindGroupEntry pcBGEntry {};
-            pcBGEntry.binding = PushConstantBinding;
-            pcBGEntry.buffer  = pushConstantBuffer;
-            pcBGEntry.offset  = 0;
-            pcBGEntry.size    = PushConstantSlotSize;
-            WGPUBindGroupDescriptor pcBGDesc {};
-            pcBGDesc.layout     = pushConstantBGL;
-            pcBGDesc.entryCount = 1;
-            pcBGDesc.entries    = &pcBGEntry;
-            pushConstantBG = wgpuDeviceCreateBindGroup(device, &pcBGDesc);
+            // Graphics and compute layouts each get their own BGL/BG over the same buffer, so
+            // graphics bindings never carry compute visibility
+            auto createPushConstantGroup = [&](WGPUShaderStage visibility,
+                                               WGPUBindGroupLayout& outBGL, WGPUBindGroup& outBG) {
+                WGPUBindGroupLayoutEntry pcEntry {};
+                pcEntry.binding                  = PushConstantBinding;
+                pcEntry.visibility               = visibility;
+                pcEntry.buffer.type              = WGPUBufferBindingType_Uniform;
+                pcEntry.buffer.hasDynamicOffset  = true;
+                pcEntry.buffer.minBindingSize    = PushConstantSlotSize;
+                WGPUBindGroupLayoutDescriptor pcBGLDesc {};
+                pcBGLDesc.entryCount = 1;
+                pcBGLDesc.entries    = &pcEntry;
+                outBGL = wgpuDeviceCreateBindGroupLayout(device, &pcBGLDesc);
+
+                WGPUBindGroupEntry pcBGEntry {};
+                pcBGEntry.binding = PushConstantBinding;
+                pcBGEntry.buffer  = pushConstantBuffer;
+                pcBGEntry.offset  = 0;
+                pcBGEntry.size    = PushConstantSlotSize;
+                WGPUBindGroupDescriptor pcBGDesc {};
+                pcBGDesc.layout     = outBGL;
+                pcBGDesc.entryCount = 1;
+                pcBGDesc.entries    = &pcBGEntry;
+                outBG = wgpuDeviceCreateBindGroup(device, &pcBGDesc);
+            };
+            createPushConstantGroup(WGPUShaderStage_Vertex | WGPUShaderStage_Fragment,
+                                    pushConstantBGL, pushConstantBG);
+            createPushConstantGroup(WGPUShaderStage_Compute, computePushConstantBGL, computePushConstantBG);
+        }
+
+        if (!transientShadow.empty()) {
+            WGPUBufferDescriptor transientDesc {};
+            transientDesc.size  = transientShadow.size();
+            transientDesc.usage = WGPUBufferUsage_Uniform | WGPUBufferUsage_Storage | WGPUBufferUsage_Vertex |
+                                  WGPUBufferUsage_Index | WGPUBufferUsage_Indirect | WGPUBufferUsage_CopyDst;
+
+            RHIBufferWebGPU buf {};
+            buf.Buffer = wgpuDeviceCreateBuffer(device, &transientDesc);
+            buf.Size   = transientShadow.size();
+            buf.Usage  = BufferUsage::UniformBuffer | BufferUsage::StorageBuffer | BufferUsage::VertexBuffer |
+                         BufferUsage::IndexBuffer | BufferUsage::Indirect;
+            buf.Access = BufferMemoryAccess::CpuToGpu;
+            transientBuffer = bufferPool.Allocate(std::move(buf));
         }
 
         // Empty BGL and BG — used to satisfy gap set slots in pipeline layouts
@@ -298,6 +340,9 @@ namespace OZZ::rendering::webgpu {
     RHIFrameContext RHIDeviceWebGPU::BeginFrame() {
         std::lock_guard<std::mutex> lock(apiMutex);
         pushConstantCursor = 0;
+        transientHead = 0;
+        descriptorSetPool.Free(transientDescriptorSets);
+        transientDescriptorSets.clear();
         auto [w, h] = platformContext.GetWindowFramebufferSizeFunction();
         uint32_t newW = static_cast<uint32_t>(w);
         uint32_t newH = static_cast<uint32_t>(h);
@@ -349,9 +394,16 @@ namespace OZZ::rendering::webgpu {
             activeRenderPassEncoder = nullptr;
         }
 
+        // Land this frame's transient allocations ahead of the commands that read them
+        if (transientHead > 0) {
+            if (auto* transient = bufferPool.Get(transientBuffer)) {
+                wgpuQueueWriteBuffer(queue, transient->Buffer, 0, transientShadow.data(), transientHead);
+            }
+        }
+
         WGPUCommandBufferDescriptor cmdDesc = {};
         WGPUCommandBuffer commands = wgpuCommandEncoderFinish(activeEncoder, &cmdDesc);
-        wgpuQueueSubmit(queue, 1, &commands);
+        submitImpl(commands);
         wgpuCommandBufferRelease(commands);
 
         wgpuCommandEncoderRelease(activeEncoder);
@@ -379,14 +431,15 @@ namespace OZZ::rendering::webgpu {
         }
         texturePool.Free(colorHandle);
 
-        currentFrameIndex = (currentFrameIndex + 1) % MaxFramesInFlight;
+        currentFrameIndex = (currentFrameIndex + 1) % framesInFlight;
 
         // Clear pending draw state
         pendingShaderHandle = RHIShaderHandle::Null();
-        pendingVertexBuffer = RHIBufferHandle::Null();
-        pendingIndexBuffer  = RHIBufferHandle::Null();
-        hasPendingIndexBuffer = false;
+        pendingVertexBuffers.fill({});
+        pendingIndexBuffer  = {};
+        pendingIndexFormat  = WGPUIndexFormat_Uint32;
         pendingDescriptorSets.fill(RHIDescriptorSetHandle::Null());
+        for (auto& offsets : pendingDynamicOffsets) offsets.clear();
     }
 
     std::pair<uint32_t, uint32_t> RHIDeviceWebGPU::GetSwapchainExtent() const {
@@ -394,6 +447,110 @@ namespace OZZ::rendering::webgpu {
         return {swapchainWidth, swapchainHeight};
     }
 
+    // -------------------------------------------------------------------------
+    // GPU progress
+    // -------------------------------------------------------------------------
+
+    uint64_t RHIDeviceWebGPU::submitImpl(WGPUCommandBuffer commands) {
+        wgpuQueueSubmit(queue, 1, &commands);
+        const uint64_t value = ++submittedGpuValue;
+        bUploadsPending = false;
+
+        struct WorkDoneData {
+            std::shared_ptr<std::atomic<uint64_t>> completed;
+            uint64_t value;
+        };
+        wgpuQueueOnSubmittedWorkDone(
+            queue,
+            [](WGPUQueueWorkDoneStatus, void* ud) {
+                // Also published on failure/device loss: nothing will complete later, and
+                // waiters must not block forever.
+                std::unique_ptr<WorkDoneData> data(static_cast<WorkDoneData*>(ud));
+                uint64_t current = data->completed->load();
+                while (current < data->value && !data->completed->compare_exchange_weak(current, data->value)) {}
+            },
+            new WorkDoneData {completedGpuValue, value});
+        return value;
+    }
+
+    uint64_t RHIDeviceWebGPU::GetSubmittedGpuValue() const {
+        return submittedGpuValue.load();
+    }
+
+    uint64_t RHIDeviceWebGPU::GetCompletedGpuValue() const {
+        return completedGpuValue->load();
+    }
+
+    bool RHIDeviceWebGPU::WaitForGpuValue(uint64_t value, uint64_t timeoutNs) {
+        if (value > submittedGpuValue.load()) {
+            spdlog::error("WaitForGpuValue: value {} has not been submitted (last submitted {})",
+                          value, submittedGpuValue.load());
+            return false;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        while (completedGpuValue->load() < value) {
+            {
+                // Work-done callbacks are delivered from wgpuDeviceTick.
+                std::lock_guard<std::mutex> lock(apiMutex);
+                wgpuDeviceTick(device);
+            }
+            if (completedGpuValue->load() >= value) break;
+            const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start);
+            if (static_cast<uint64_t>(elapsed.count()) >= timeoutNs) return false;
+            std::this_thread::yield();
+        }
+        return true;
+    }
+
+    // -------------------------------------------------------------------------
+    // Parallel Recording
+    // -------------------------------------------------------------------------
+
+    // Dawn's encoders are not thread-safe and this backend keeps the pending draw state
+    // device-wide, so there is nothing to hand out. Callers fall back to recording on the
+    // frame context, and RenderPassDescriptor::ParallelRecording is ignored.
+    std::vector<RHIFrameContext> RHIDeviceWebGPU::ForkRecordingContexts(const RHIFrameContext&, uint32_t) {
+        static std::once_flag warnOnce;
+        std::call_once(warnOnce, [] {
+            spdlog::warn("WebGPU: parallel recording is not supported; record on the frame context");
+        });
+        return {};
+    }
+
+    void RHIDeviceWebGPU::JoinRecordingContexts(const RHIFrameContext&, std::vector<RHIFrameContext>&& recordingContexts) {
+        recordingContexts.clear();
+    }
+
+    // -------------------------------------------------------------------------
+    // Async Compute
+    // -------------------------------------------------------------------------
+
+    RHIFrameContext RHIDeviceWebGPU::BeginAsyncCompute(const RHIFrameContext&) {
+        static std::once_flag warnOnce;
+        std::call_once(warnOnce, [] {
+            spdlog::warn("WebGPU: async compute is not supported; dispatch on the frame context");
+        });
+        return RHIFrameContext::Null();
+    }
+
+    GpuSyncPoint RHIDeviceWebGPU::SubmitAsyncCompute(RHIFrameContext&&) {
+        return {};
+    }
+
+    // WebGPU has a single queue and the frame's commands are recorded into one encoder, so
+    // everything already executes in recording order; there is nothing to flush.
+    GpuSyncPoint RHIDeviceWebGPU::FlushGraphics(const RHIFrameContext&) {
+        return {};
+    }
+
+    void RHIDeviceWebGPU::AddQueueDependency(const RHIFrameContext&, const GpuSyncPoint&, PipelineStage) {}
+
+    uint32_t RHIDeviceWebGPU::GetQueueFamily(QueueType) const {
+        return QueueFamilyIgnored;
+    }
+
     // -------------------------------------------------------------------------
     // Render Pass
     // -------------------------------------------------------------------------
@@ -411,8 +568,10 @@ namespace OZZ::rendering::webgpu {
 
         // Graphics state does not carry across render passes: callers must call
         // SetGraphicsState after each BeginRenderPass, before any draw.
-        pendingState     = {};
-        stateSetThisPass = false;
+        pendingState       = {};
+        pendingStateHash   = 0;
+        pendingStateHandle = RHIGraphicsStateHandle::Null();
+        stateSetThisPass   = false;
 
         std::vector<WGPURenderPassColorAttachment> colorAttachments;
         colorAttachments.reserve(rpDesc.ColorAttachmentCount);
@@ -431,6 +590,10 @@ namespace OZZ::rendering::webgpu {
 
             WGPURenderPassColorAttachment ca = {};
             ca.view       = tex->TextureView;
+            // WebGPU always averages; ResolveMode only matters for Vulkan
+            if (auto* resolveTex = texturePool.Get(att.ResolveTexture)) {
+                ca.resolveTarget = resolveTex->TextureView;
+            }
             ca.loadOp     = ToWebGPU(att.Load);
             ca.storeOp    = ToWebGPU(att.Store);
             ca.clearValue = {att.Clear.R, att.Clear.G, att.Clear.B, att.Clear.A};
@@ -443,6 +606,9 @@ namespace OZZ::rendering::webgpu {
         if (rpDesc.DepthAttachment.Texture.IsValid()) {
             auto* dTex = texturePool.Get(rpDesc.DepthAttachment.Texture);
             if (dTex) {
+                if (rpDesc.DepthAttachment.ResolveTexture.IsValid()) {
+                    spdlog::error("BeginRenderPass: WebGPU cannot resolve depth attachments");
+                }
                 depthAtt.view            = dTex->TextureView;
                 depthAtt.depthLoadOp     = ToWebGPU(rpDesc.DepthAttachment.Load);
                 depthAtt.depthStoreOp    = ToWebGPU(rpDesc.DepthAttachment.Store);
@@ -474,6 +640,7 @@ namespace OZZ::rendering::webgpu {
         wgpuRpDesc.depthStencilAttachment = depthAttPtr;
 
         activeRenderPassEncoder = wgpuCommandEncoderBeginRenderPass(activeEncoder, &wgpuRpDesc);
+        activePipeline          = nullptr;
     }
 
     void RHIDeviceWebGPU::EndRenderPass(const RHIFrameContext&) {
@@ -496,6 +663,13 @@ namespace OZZ::rendering::webgpu {
     void RHIDeviceWebGPU::BufferMemoryBarrier(const RHIFrameContext&,
                                                const BufferBarrierDescriptor&) {}
 
+    void RHIDeviceWebGPU::PipelineBarriers(const RHIFrameContext&,
+                                            std::span<const TextureBarrierDescriptor>,
+                                            std::span<const BufferBarrierDescriptor>) {}
+
+    void RHIDeviceWebGPU::TransitionTexture(const RHIFrameContext&, const RHITextureHandle&,
+                                             TextureState, const TextureSubresourceRange&) {}
+
     // -------------------------------------------------------------------------
     // State recording
     // -------------------------------------------------------------------------
@@ -532,8 +706,32 @@ namespace OZZ::rendering::webgpu {
     void RHIDeviceWebGPU::SetGraphicsState(const RHIFrameContext&,
                                             const GraphicsStateDescriptor& state) {
         std::lock_guard<std::mutex> lock(apiMutex);
-        pendingState     = state;
-        stateSetThisPass = true;
+        pendingState       = state;
+        pendingStateHash   = HashGraphicsState(state);
+        pendingStateHandle = RHIGraphicsStateHandle::Null();
+        stateSetThisPass   = true;
+    }
+
+    void RHIDeviceWebGPU::SetGraphicsState(const RHIFrameContext&,
+                                            const RHIGraphicsStateHandle& handle) {
+        std::lock_guard<std::mutex> lock(apiMutex);
+        pendingStateHandle = handle;
+        stateSetThisPass   = true;
+    }
+
+    RHIGraphicsStateHandle RHIDeviceWebGPU::CreateGraphicsState(const GraphicsStateDescriptor& state) {
+        return graphicsStatePool.Allocate(RHIGraphicsStateWebGPU {
+            .Descriptor = state,
+            .Hash       = HashGraphicsState(state),
+        });
+    }
+
+    void RHIDeviceWebGPU::FreeGraphicsState(const RHIGraphicsStateHandle& handle) {
+        graphicsStatePool.Free(handle);
+    }
+
+    uint64_t RHIDeviceWebGPU::GetElidedStateCommandCount() const {
+        return elidedPipelineBinds.load(std::memory_order_relaxed);
     }
 
     void RHIDeviceWebGPU::BindShader(const RHIFrameContext&, const RHIShaderHandle& handle) {
@@ -546,13 +744,37 @@ namespace OZZ::rendering::webgpu {
         auto* buf = bufferPool.Get(handle);
         if (!buf) return;
         if (static_cast<uint8_t>(buf->Usage) & static_cast<uint8_t>(BufferUsage::VertexBuffer))
-            pendingVertexBuffer = handle;
+            pendingVertexBuffers[0] = {handle, 0};
         if (static_cast<uint8_t>(buf->Usage) & static_cast<uint8_t>(BufferUsage::IndexBuffer)) {
-            pendingIndexBuffer    = handle;
-            hasPendingIndexBuffer = true;
+            pendingIndexBuffer = {handle, 0};
+            pendingIndexFormat = WGPUIndexFormat_Uint32;
         }
     }
 
+    void RHIDeviceWebGPU::BindVertexBuffers(const RHIFrameContext&, uint32_t firstBinding,
+                                             std::span<const RHIBufferHandle> handles,
+                                             std::span<const uint64_t> offsets) {
+        std::lock_guard<std::mutex> lock(apiMutex);
+        if (firstBinding + handles.size() > MaxVertexBindings) {
+            spdlog::error("WebGPU: BindVertexBuffers past MaxVertexBindings ({})", MaxVertexBindings);
+            return;
+        }
+        if (!offsets.empty() && offsets.size() != handles.size()) {
+            spdlog::error("WebGPU: BindVertexBuffers with {} offsets for {} buffers", offsets.size(), handles.size());
+            return;
+        }
+        for (size_t i = 0; i < handles.size(); i++) {
+            pendingVertexBuffers[firstBinding + i] = {handles[i], offsets.empty() ? 0 : offsets[i]};
+        }
+    }
+
+    void RHIDeviceWebGPU::BindIndexBuffer(const RHIFrameContext&, const RHIBufferHandle& handle,
+                                           uint64_t offset, IndexType indexType) {
+        std::lock_guard<std::mutex> lock(apiMutex);
+        pendingIndexBuffer = {handle, offset};
+        pendingIndexFormat = ToWebGPU(indexType);
+    }
+
     void RHIDeviceWebGPU::SetPushConstants(const RHIFrameContext&,
                                             RHIPipelineLayoutHandle,
                                             ShaderStageFlags,
@@ -576,10 +798,13 @@ namespace OZZ::rendering::webgpu {
     void RHIDeviceWebGPU::BindDescriptorSet(const RHIFrameContext&,
                                              RHIPipelineLayoutHandle,
                                              uint32_t setIndex,
-                                             RHIDescriptorSetHandle descriptorSetHandle) {
+                                             RHIDescriptorSetHandle descriptorSetHandle,
+                                             std::span<const uint32_t> dynamicOffsets) {
         std::lock_guard<std::mutex> lock(apiMutex);
-        if (setIndex < MaxBoundDescriptorSets)
+        if (setIndex < MaxBoundDescriptorSets) {
             pendingDescriptorSets[setIndex] = descriptorSetHandle;
+            pendingDynamicOffsets[setIndex].assign(dynamicOffsets.begin(), dynamicOffsets.end());
+        }
     }
 
     // -------------------------------------------------------------------------
@@ -718,35 +943,89 @@ namespace OZZ::rendering::webgpu {
         if (!activeRenderPassEncoder) return false;
         auto* shader = shaderPool.Get(pendingShaderHandle);
         if (!shader) return false;
+        if (shader->bIsCompute) {
+            spdlog::error("WebGPU: draw issued with a compute shader bound");
+            return false;
+        }
 
-        auto* pipelineLayout = pipelineLayoutPool.Get(shader->pipelineLayoutHandle);
-
-        PipelineKey key {};
-        key.shader         = pendingShaderHandle;
-        key.state          = pendingState;
-        key.colorFormat    = activePassColorFormat;
-        key.depthFormat    = activePassDepthFormat;
-        key.pipelineLayout = pipelineLayout ? *pipelineLayout : nullptr;
+        WGPURenderPipeline pipeline = nullptr;
+        if (pendingStateHandle.IsValid() && lastStatePipeline.Pipeline &&
+            lastStatePipeline.Shader == pendingShaderHandle && lastStatePipeline.State == pendingStateHandle &&
+            lastStatePipeline.ColorFormat == activePassColorFormat &&
+            lastStatePipeline.DepthFormat == activePassDepthFormat) {
+            pipeline = lastStatePipeline.Pipeline;
+        } else {
+            const GraphicsStateDescriptor* state = &pendingState;
+            uint64_t stateHash = pendingStateHash;
+            if (pendingStateHandle.IsValid()) {
+                auto* graphicsState = graphicsStatePool.Get(pendingStateHandle);
+                if (!graphicsState) {
+                    spdlog::error("WebGPU: draw issued with an invalid graphics state handle");
+                    return false;
+                }
+                state     = &graphicsState->Descriptor;
+                stateHash = graphicsState->Hash;
+            }
 
-        WGPURenderPipeline pipeline = pipelineCache.GetOrCreate(key,
-            [&](const PipelineKey& k) { return buildPipeline(k, *shader); });
-        if (!pipeline) {
-            spdlog::error("WebGPU: pipeline build failed for shaderHandle.Id={}", pendingShaderHandle.Id);
-            return false;
+            auto* pipelineLayout = pipelineLayoutPool.Get(shader->pipelineLayoutHandle);
+
+            PipelineKey key {};
+            key.shader         = pendingShaderHandle;
+            key.state          = *state;
+            key.stateHash      = stateHash;
+            key.colorFormat    = activePassColorFormat;
+            key.depthFormat    = activePassDepthFormat;
+            key.pipelineLayout = pipelineLayout ? *pipelineLayout : nullptr;
+
+            pipeline = pipelineCache.GetOrCreate(key,
+                [&](const PipelineKey& k) { return buildPipeline(k, *shader); });
+            if (!pipeline) {
+                spdlog::error("WebGPU: pipeline build failed for shaderHandle.Id={}", pendingShaderHandle.Id);
+                return false;
+            }
+            if (pendingStateHandle.IsValid()) {
+                lastStatePipeline = StatePipeline {
+                    .Shader      = pendingShaderHandle,
+                    .State       = pendingStateHandle,
+                    .ColorFormat = activePassColorFormat,
+                    .DepthFormat = activePassDepthFormat,
+                    .Pipeline    = pipeline,
+                };
+            }
         }
 
-        wgpuRenderPassEncoderSetPipeline(activeRenderPassEncoder, pipeline);
+        if (pipeline != activePipeline) {
+            wgpuRenderPassEncoderSetPipeline(activeRenderPassEncoder, pipeline);
+            activePipeline = pipeline;
+        } else {
+            elidedPipelineBinds.fetch_add(1, std::memory_order_relaxed);
+        }
 
-        if (pendingVertexBuffer.IsValid()) {
-            auto* vb = bufferPool.Get(pendingVertexBuffer);
-            if (vb) wgpuRenderPassEncoderSetVertexBuffer(activeRenderPassEncoder, 0, vb->Buffer, 0, vb->Size);
+        for (uint32_t slot = 0; slot < MaxVertexBindings; slot++) {
+            const auto& binding = pendingVertexBuffers[slot];
+            if (!binding.Buffer.IsValid()) continue;
+            auto* vb = bufferPool.Get(binding.Buffer);
+            if (vb && binding.Offset <= vb->Size)
+                wgpuRenderPassEncoderSetVertexBuffer(activeRenderPassEncoder, slot, vb->Buffer,
+                                                     binding.Offset, vb->Size - binding.Offset);
         }
 
+        applyPendingBindGroups(*shader, [&](uint32_t index, WGPUBindGroup group,
+                                            size_t offsetCount, const uint32_t* offsets) {
+            wgpuRenderPassEncoderSetBindGroup(activeRenderPassEncoder, index, group, offsetCount, offsets);
+        });
+
+        return true;
+    }
+
+    void RHIDeviceWebGPU::applyPendingBindGroups(
+        const RHIShaderWebGPU& shader,
+        const std::function<void(uint32_t, WGPUBindGroup, size_t, const uint32_t*)>& setBindGroup) {
         for (uint32_t i = 0; i < MaxBoundDescriptorSets; i++) {
             if (!pendingDescriptorSets[i].IsValid()) continue;
             auto* ds = descriptorSetPool.Get(pendingDescriptorSets[i]);
             if (ds && ds->bindGroup)
-                wgpuRenderPassEncoderSetBindGroup(activeRenderPassEncoder, i, ds->bindGroup, 0, nullptr);
+                setBindGroup(i, ds->bindGroup, pendingDynamicOffsets[i].size(), pendingDynamicOffsets[i].data());
         }
 
         // Only bind group PushConstantSet if THIS shader's pipeline layout actually
@@ -756,21 +1035,19 @@ namespace OZZ::rendering::webgpu {
         // WebGPU then rejects the whole command buffer ("does not match layout... at
         // group index 3" or "no bind group set at group index 1" once the resulting gap
         // in set numbering is also skipped).
-        const bool hasPushConstants = shader->pipelineLayoutDescriptor.PushConstantCount > 0;
-        if (pushConstantBG && hasPushConstants) {
+        const bool hasPushConstants = shader.pipelineLayoutDescriptor.PushConstantCount > 0;
+        WGPUBindGroup pcBG = shader.bIsCompute ? computePushConstantBG : pushConstantBG;
+        if (pcBG && hasPushConstants) {
             // Bind empty groups for gap slots (between last real set and PushConstantSet)
             for (uint32_t i = 1; i < PushConstantSet; i++) {
                 if (!pendingDescriptorSets[i].IsValid() && emptyBG)
-                    wgpuRenderPassEncoderSetBindGroup(activeRenderPassEncoder, i, emptyBG, 0, nullptr);
+                    setBindGroup(i, emptyBG, 0, nullptr);
             }
             // pendingPushConstantOffset is sticky: a draw whose shader declares push
             // constants but never called SetPushConstants this frame reuses the previous
             // draw's slot — intentional, matching Vulkan push-constant stickiness.
-            wgpuRenderPassEncoderSetBindGroup(activeRenderPassEncoder, PushConstantSet,
-                                              pushConstantBG, 1, &pendingPushConstantOffset);
+            setBindGroup(PushConstantSet, pcBG, 1, &pendingPushConstantOffset);
         }
-
-        return true;
     }
 
     void RHIDeviceWebGPU::Draw(const RHIFrameContext&,
@@ -789,17 +1066,149 @@ namespace OZZ::rendering::webgpu {
                                        uint32_t firstInstance) {
         std::lock_guard<std::mutex> lock(apiMutex);
         if (!flushPendingDrawState()) return;
-
-        if (hasPendingIndexBuffer && pendingIndexBuffer.IsValid()) {
-            auto* ib = bufferPool.Get(pendingIndexBuffer);
-            if (ib) wgpuRenderPassEncoderSetIndexBuffer(activeRenderPassEncoder, ib->Buffer,
-                                                         WGPUIndexFormat_Uint32, 0, ib->Size);
-        }
+        applyPendingIndexBuffer();
 
         wgpuRenderPassEncoderDrawIndexed(activeRenderPassEncoder, indexCount, instanceCount,
                                           firstIndex, vertexOffset, firstInstance);
     }
 
+    void RHIDeviceWebGPU::DrawIndirect(const RHIFrameContext&,
+                                        const RHIBufferHandle& argumentBuffer, uint64_t offset,
+                                        uint32_t drawCount, uint32_t stride) {
+        std::lock_guard<std::mutex> lock(apiMutex);
+        drawIndirectImpl(false, argumentBuffer, offset, drawCount, stride);
+    }
+
+    void RHIDeviceWebGPU::DrawIndexedIndirect(const RHIFrameContext&,
+                                               const RHIBufferHandle& argumentBuffer, uint64_t offset,
+                                               uint32_t drawCount, uint32_t stride) {
+        std::lock_guard<std::mutex> lock(apiMutex);
+        drawIndirectImpl(true, argumentBuffer, offset, drawCount, stride);
+    }
+
+    // No count buffers in WebGPU: all maxDrawCount entries are drawn, which the RHIDevice
+    // contract makes equivalent as long as entries past the count have InstanceCount 0.
+    void RHIDeviceWebGPU::DrawIndirectCount(const RHIFrameContext&,
+                                             const RHIBufferHandle& argumentBuffer, uint64_t offset,
+                                             const RHIBufferHandle&, uint64_t,
+                                             uint32_t maxDrawCount, uint32_t stride) {
+        std::lock_guard<std::mutex> lock(apiMutex);
+        drawIndirectImpl(false, argumentBuffer, offset, maxDrawCount, stride);
+    }
+
+    void RHIDeviceWebGPU::DrawIndexedIndirectCount(const RHIFrameContext&,
+                                                    const RHIBufferHandle& argumentBuffer, uint64_t offset,
+                                                    const RHIBufferHandle&, uint64_t,
+                                                    uint32_t maxDrawCount, uint32_t stride) {
+        std::lock_guard<std::mutex> lock(apiMutex);
+        drawIndirectImpl(true, argumentBuffer, offset, maxDrawCount, stride);
+    }
+
+    void RHIDeviceWebGPU::applyPendingIndexBuffer() {
+        if (!pendingIndexBuffer.Buffer.IsValid()) return;
+        auto* ib = bufferPool.Get(pendingIndexBuffer.Buffer);
+        if (ib && pendingIndexBuffer.Offset <= ib->Size)
+            wgpuRenderPassEncoderSetIndexBuffer(activeRenderPassEncoder, ib->Buffer, pendingIndexFormat,
+                                                pendingIndexBuffer.Offset, ib->Size - pendingIndexBuffer.Offset);
+    }
+
+    void RHIDeviceWebGPU::drawIndirectImpl(bool bIndexed,
+                                           const RHIBufferHandle& argumentBuffer, uint64_t offset,
+                                           uint32_t drawCount, uint32_t stride) {
+        auto* args = bufferPool.Get(argumentBuffer);
+        if (!args || !args->Buffer || !has(args->Usage, BufferUsage::Indirect)) {
+            spdlog::error("WebGPU: indirect draw with an invalid or non-Indirect argument buffer");
+            return;
+        }
+        if (drawCount == 0 || !flushPendingDrawState()) return;
+
+        if (bIndexed) applyPendingIndexBuffer();
+
+        for (uint32_t i = 0; i < drawCount; ++i) {
+            const uint64_t drawOffset = offset + static_cast<uint64_t>(i) * stride;
+            if (bIndexed) {
+                wgpuRenderPassEncoderDrawIndexedIndirect(activeRenderPassEncoder, args->Buffer, drawOffset);
+            } else {
+                wgpuRenderPassEncoderDrawIndirect(activeRenderPassEncoder, args->Buffer, drawOffset);
+            }
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // Compute
+    // -------------------------------------------------------------------------
+
+    WGPUComputePipeline RHIDeviceWebGPU::buildComputePipeline(const ComputePipelineKey& key,
+                                                               const RHIShaderWebGPU& shader) {
+        WGPUComputePipelineDescriptor desc {};
+        desc.layout             = key.pipelineLayout;
+        desc.compute.module     = shader.computeModule;
+        desc.compute.entryPoint = shader.computeEntryPoint.c_str();
+        return wgpuDeviceCreateComputePipeline(device, &desc);
+    }
+
+    WGPUComputePassEncoder RHIDeviceWebGPU::beginComputePass() {
+        if (activeRenderPassEncoder) {
+            spdlog::error("WebGPU: dispatch recorded inside a render pass; end the pass first");
+            return nullptr;
+        }
+        if (!activeEncoder) return nullptr;
+        auto* shader = shaderPool.Get(pendingShaderHandle);
+        if (!shader || !shader->bIsCompute) {
+            spdlog::error("WebGPU: dispatch issued without a compute shader bound");
+            return nullptr;
+        }
+
+        auto* pipelineLayout = pipelineLayoutPool.Get(shader->pipelineLayoutHandle);
+
+        ComputePipelineKey key {};
+        key.shader         = pendingShaderHandle;
+        key.pipelineLayout = pipelineLayout ? *pipelineLayout : nullptr;
+
+        WGPUComputePipeline pipeline = computePipelineCache.GetOrCreate(key,
+            [&](const ComputePipelineKey& k) { return buildComputePipeline(k, *shader); });
+        if (!pipeline) {
+            spdlog::error("WebGPU: compute pipeline build failed for shaderHandle.Id={}", pendingShaderHandle.Id);
+            return nullptr;
+        }
+
+        WGPUComputePassDescriptor passDesc {};
+        WGPUComputePassEncoder pass = wgpuCommandEncoderBeginComputePass(activeEncoder, &passDesc);
+        wgpuComputePassEncoderSetPipeline(pass, pipeline);
+        applyPendingBindGroups(*shader, [&](uint32_t index, WGPUBindGroup group,
+                                            size_t offsetCount, const uint32_t* offsets) {
+            wgpuComputePassEncoderSetBindGroup(pass, index, group, offsetCount, offsets);
+        });
+        return pass;
+    }
+
+    void RHIDeviceWebGPU::Dispatch(const RHIFrameContext&,
+                                    uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) {
+        std::lock_guard<std::mutex> lock(apiMutex);
+        WGPUComputePassEncoder pass = beginComputePass();
+        if (!pass) return;
+
+        wgpuComputePassEncoderDispatchWorkgroups(pass, groupCountX, groupCountY, groupCountZ);
+        wgpuComputePassEncoderEnd(pass);
+        wgpuComputePassEncoderRelease(pass);
+    }
+
+    void RHIDeviceWebGPU::DispatchIndirect(const RHIFrameContext&,
+                                            const RHIBufferHandle& bufferHandle, uint64_t offset) {
+        std::lock_guard<std::mutex> lock(apiMutex);
+        auto* buf = bufferPool.Get(bufferHandle);
+        if (!buf || !buf->Buffer) {
+            spdlog::error("WebGPU: DispatchIndirect with an invalid buffer handle");
+            return;
+        }
+        WGPUComputePassEncoder pass = beginComputePass();
+        if (!pass) return;
+
+        wgpuComputePassEncoderDispatchWorkgroupsIndirect(pass, buf->Buffer, offset);
+        wgpuComputePassEncoderEnd(pass);
+        wgpuComputePassEncoderRelease(pass);
+    }
+
     // -------------------------------------------------------------------------
     // Descriptor Sets
     // -------------------------------------------------------------------------
@@ -876,9 +1285,17 @@ namespace OZZ::rendering::webgpu {
             switch (write.Type) {
                 case DescriptorType::UniformBuffer:
                 case DescriptorType::StorageBuffer:
-                case DescriptorType::ReadOnlyStorageBuffer: {
+                case DescriptorType::ReadOnlyStorageBuffer:
+                case DescriptorType::UniformBufferDynamic:
+                case DescriptorType::StorageBufferDynamic: {
                     auto* buf = bufferPool.Get(write.Buffer.Buffer);
                     if (!buf) continue;
+                    // Same contract as Vulkan, where a Stream buffer's current copy changes every frame
+                    if (buf->Lifetime == BufferLifetime::Stream && !ds->bTransient) {
+                        spdlog::error("UpdateDescriptorSet: Stream buffer at binding {} needs a transient "
+                                      "descriptor set", write.Binding);
+                        continue;
+                    }
                     entry.buffer = buf->Buffer;
                     entry.offset = write.Buffer.Offset;
                     entry.size   = (write.Buffer.Range == ~0ULL) ? buf->Size : write.Buffer.Range;
@@ -906,6 +1323,12 @@ namespace OZZ::rendering::webgpu {
                     entry.sampler = tex->Sampler;
                     break;
                 }
+                case DescriptorType::StorageImage: {
+                    auto* tex = texturePool.Get(write.Image.Texture);
+                    if (!tex) continue;
+                    entry.textureView = tex->TextureView;
+                    break;
+                }
                 default: continue;
             }
             entries.push_back(entry);
@@ -923,6 +1346,17 @@ namespace OZZ::rendering::webgpu {
         descriptorSetPool.Free(handle);
     }
 
+    RHIDescriptorSetHandle RHIDeviceWebGPU::AllocateTransientDescriptorSet(const RHIFrameContext&,
+                                                                           RHIDescriptorSetLayoutHandle layoutHandle) {
+        std::lock_guard<std::mutex> lock(apiMutex);
+        DescriptorSetData ds {};
+        ds.layoutHandle = layoutHandle;
+        ds.bTransient   = true;
+        const RHIDescriptorSetHandle handle = descriptorSetPool.Allocate(std::move(ds));
+        transientDescriptorSets.push_back(handle);
+        return handle;
+    }
+
     // -------------------------------------------------------------------------
     // Textures
     // -------------------------------------------------------------------------
@@ -935,13 +1369,37 @@ namespace OZZ::rendering::webgpu {
     RHITextureHandle RHIDeviceWebGPU::createTextureImpl(TextureDescriptor&& descriptor) {
         // Unlocked: callers hold apiMutex (public CreateTexture, BeginFrame's depth
         // recreate) or run single-threaded during construction (createDepthTexture).
+        const bool bMultisampled = descriptor.Samples != SampleCount::Count1;
+        if (bMultisampled) {
+            // WebGPU only has 1 and 4 sample textures, and multisampled ones are render targets
+            // that can not be uploaded to or written as storage
+            if (descriptor.Samples != SampleCount::Count4) {
+                spdlog::error("Failed to create texture. WebGPU supports 1 or 4 samples, not {}.",
+                              static_cast<uint32_t>(descriptor.Samples));
+                return RHITextureHandle::Null();
+            }
+            if (!has(descriptor.Usage, TextureUsage::ColorAttachment | TextureUsage::DepthAttachment)) {
+                spdlog::error("Failed to create texture. Multisampled textures must be color or depth attachments.");
+                return RHITextureHandle::Null();
+            }
+            if (has(descriptor.Usage, TextureUsage::Storage | TextureUsage::TransferDst)) {
+                spdlog::error("Failed to create texture. Multisampled textures can not have Storage or TransferDst "
+                              "usage.");
+                return RHITextureHandle::Null();
+            }
+        }
+
         WGPUTextureDescriptor desc {};
         desc.usage           = ToWebGPU(descriptor.Usage);
+        if (bMultisampled) {
+            // Sampled implies CopyDst for uploads, which multisampled textures do not allow
+            desc.usage &= ~WGPUTextureUsage_CopyDst;
+        }
         desc.dimension       = WGPUTextureDimension_2D;
         desc.size            = {descriptor.Width, descriptor.Height, 1};
         desc.format          = ToWebGPU(descriptor.Format);
         desc.mipLevelCount   = 1;
-        desc.sampleCount     = 1;
+        desc.sampleCount     = static_cast<uint32_t>(descriptor.Samples);
         desc.viewFormatCount = 0;
 
         RHITextureWebGPU tex {};
@@ -983,6 +1441,56 @@ namespace OZZ::rendering::webgpu {
     void RHIDeviceWebGPU::UpdateTexture(const RHITextureHandle& handle,
                                          const void* data, size_t size) {
         std::lock_guard<std::mutex> lock(apiMutex);
+        // Queue writes are ordered before any later submit; nothing to wait for.
+        updateTextureImpl(handle, data, size);
+    }
+
+    UploadTicket RHIDeviceWebGPU::UpdateTextureAsync(const RHITextureHandle& handle,
+                                                     const void* data, size_t size) {
+        std::lock_guard<std::mutex> lock(apiMutex);
+        auto* tex = texturePool.Get(handle);
+        if (!tex || !tex->Texture) return {};
+
+        updateTextureImpl(handle, data, size);
+        bUploadsPending = true;
+        return {.Value = submittedGpuValue.load() + 1};
+    }
+
+    UploadTicket RHIDeviceWebGPU::SubmitUploads() {
+        std::lock_guard<std::mutex> lock(apiMutex);
+        if (bUploadsPending) {
+            // An empty submit is enough to flush the queued writes and get a value to wait on.
+            WGPUCommandEncoderDescriptor encDesc = {};
+            WGPUCommandEncoder encoder = wgpuDeviceCreateCommandEncoder(device, &encDesc);
+            WGPUCommandBufferDescriptor cmdDesc = {};
+            WGPUCommandBuffer commands = wgpuCommandEncoderFinish(encoder, &cmdDesc);
+            submitImpl(commands);
+            wgpuCommandBufferRelease(commands);
+            wgpuCommandEncoderRelease(encoder);
+        }
+        return {.Value = submittedGpuValue.load()};
+    }
+
+    bool RHIDeviceWebGPU::IsUploadComplete(const UploadTicket& ticket) {
+        if (ticket.Value > submittedGpuValue.load()) return false;
+        if (completedGpuValue->load() >= ticket.Value) return true;
+        {
+            // Work-done callbacks are delivered from wgpuDeviceTick.
+            std::lock_guard<std::mutex> lock(apiMutex);
+            wgpuDeviceTick(device);
+        }
+        return completedGpuValue->load() >= ticket.Value;
+    }
+
+    bool RHIDeviceWebGPU::WaitForUpload(const UploadTicket& ticket, uint64_t timeoutNs) {
+        if (ticket.Value > submittedGpuValue.load()) {
+            SubmitUploads();
+        }
+        return WaitForGpuValue(ticket.Value, timeoutNs);
+    }
+
+    void RHIDeviceWebGPU::updateTextureImpl(const RHITextureHandle& handle,
+                                            const void* data, size_t size) {
         auto* tex = texturePool.Get(handle);
         if (!tex || !tex->Texture) return;
 
@@ -1008,6 +1516,15 @@ namespace OZZ::rendering::webgpu {
         freeTextureImpl(handle);
     }
 
+    // Core WebGPU has no descriptor indexing, so nothing is ever registered
+    uint32_t RHIDeviceWebGPU::GetBindlessIndex(const RHITextureHandle&) {
+        return InvalidBindlessIndex;
+    }
+
+    uint32_t RHIDeviceWebGPU::GetBindlessIndex(const RHIBufferHandle&) {
+        return InvalidBindlessIndex;
+    }
+
     void RHIDeviceWebGPU::freeTextureImpl(RHITextureHandle handle) {
         // Unlocked: callers hold apiMutex (public FreeTexture, BeginFrame's depth recreate).
         texturePool.Free(handle);
@@ -1044,6 +1561,26 @@ namespace OZZ::rendering::webgpu {
         return handle;
     }
 
+    RHIShaderHandle RHIDeviceWebGPU::CreateComputeShader(ComputeShaderFileParams&& fileParams) {
+        std::lock_guard<std::mutex> lock(apiMutex);
+        RHIShaderWebGPU shader(device, slangSession, std::move(fileParams));
+        if (!shader.IsValid()) return RHIShaderHandle::Null();
+        RHIShaderHandle handle = shaderPool.Allocate(std::move(shader));
+        auto* s = shaderPool.Get(handle);
+        registerShaderLayouts(handle, *s);
+        return handle;
+    }
+
+    RHIShaderHandle RHIDeviceWebGPU::CreateComputeShader(ComputeShaderSourceParams&& sourceParams) {
+        std::lock_guard<std::mutex> lock(apiMutex);
+        RHIShaderWebGPU shader(device, slangSession, std::move(sourceParams));
+        if (!shader.IsValid()) return RHIShaderHandle::Null();
+        RHIShaderHandle handle = shaderPool.Allocate(std::move(shader));
+        auto* s = shaderPool.Get(handle);
+        registerShaderLayouts(handle, *s);
+        return handle;
+    }
+
     void RHIDeviceWebGPU::FreeShader(const RHIShaderHandle& handle) {
         std::lock_guard<std::mutex> lock(apiMutex);
         shaderPool.Free(handle);
@@ -1119,9 +1656,12 @@ namespace OZZ::rendering::webgpu {
             auto* data = bindGroupLayoutPool.Get(h);
             if (data && data->bgl) bgls.push_back(data->bgl);
         }
-        // Append the dynamic-offset push-constant BGL at slot PushConstantSet when declared.
-        if (desc.PushConstantCount > 0 && pushConstantBGL) {
-            bgls.push_back(pushConstantBGL);
+        // Append the dynamic-offset push-constant BGL at slot PushConstantSet when declared,
+        // with compute visibility only for compute layouts.
+        if (desc.PushConstantCount > 0) {
+            const bool bCompute = desc.PushConstants[0].StageFlags == ShaderStageFlags::Compute;
+            WGPUBindGroupLayout pcBGL = bCompute ? computePushConstantBGL : pushConstantBGL;
+            if (pcBGL) bgls.push_back(pcBGL);
         }
 
         WGPUPipelineLayoutDescriptor plDesc {};
@@ -1205,6 +1745,14 @@ namespace OZZ::rendering::webgpu {
                 case DescriptorType::ReadOnlyStorageBuffer:
                     entry.buffer.type = WGPUBufferBindingType_ReadOnlyStorage;
                     break;
+                case DescriptorType::UniformBufferDynamic:
+                    entry.buffer.type             = WGPUBufferBindingType_Uniform;
+                    entry.buffer.hasDynamicOffset = true;
+                    break;
+                case DescriptorType::StorageBufferDynamic:
+                    entry.buffer.type             = WGPUBufferBindingType_Storage;
+                    entry.buffer.hasDynamicOffset = true;
+                    break;
                 case DescriptorType::SampledImage: {
                     // Default: Float sample type. Lazily promoted to UnfilterableFloat once
                     // UpdateDescriptorSet observes a depth-format texture bound here
@@ -1256,7 +1804,8 @@ namespace OZZ::rendering::webgpu {
     }
 
     RHIDescriptorSetLayoutHandle
-    RHIDeviceWebGPU::CreateDescriptorSetLayout(const RHIDescriptorSetLayoutDescriptor& desc) {
+    RHIDeviceWebGPU::CreateDescriptorSetLayout(const RHIDescriptorSetLayoutDescriptor& desc,
+                                               const RHIPipelineLayoutHandle&) {
         std::lock_guard<std::mutex> lock(apiMutex);
         return createDescriptorSetLayoutImpl(desc);
     }
@@ -1278,26 +1827,71 @@ namespace OZZ::rendering::webgpu {
 
     RHIBufferHandle RHIDeviceWebGPU::CreateBuffer(BufferDescriptor&& desc) {
         std::lock_guard<std::mutex> lock(apiMutex);
+        // Initial data goes in through mappedAtCreation, which (like wgpuQueueWriteBuffer) needs
+        // a multiple of 4 bytes; the padding past desc.Size stays zero
+        const uint64_t paddedSize = (desc.Size + 3) / 4 * 4;
         WGPUBufferDescriptor wgpuDesc {};
-        wgpuDesc.size  = desc.Size;
+        wgpuDesc.size  = paddedSize;
         wgpuDesc.usage = ToWebGPU(desc.Usage) | WGPUBufferUsage_CopyDst; // CopyDst for WriteBuffer
         if (desc.Access == BufferMemoryAccess::GpuToCpu)
             wgpuDesc.usage |= WGPUBufferUsage_CopySrc | WGPUBufferUsage_MapRead;
-        wgpuDesc.mappedAtCreation = false;
+        wgpuDesc.mappedAtCreation = desc.InitialData != nullptr;
 
         RHIBufferWebGPU buf {};
         buf.Buffer = wgpuDeviceCreateBuffer(device, &wgpuDesc);
         buf.Size   = desc.Size;
         buf.Usage  = desc.Usage;
         buf.Access = desc.Access;
+        buf.Lifetime = desc.Lifetime;
+        if (desc.InitialData && buf.Buffer) {
+            if (void* mapped = wgpuBufferGetMappedRange(buf.Buffer, 0, paddedSize)) {
+                std::memcpy(mapped, desc.InitialData, desc.Size);
+            } else {
+                spdlog::error("CreateBuffer: failed to map buffer for its initial data");
+            }
+            wgpuBufferUnmap(buf.Buffer);
+        }
         return bufferPool.Allocate(std::move(buf));
     }
 
+    TransientAllocation
+    RHIDeviceWebGPU::AllocateTransient(const RHIFrameContext&, uint64_t size, BufferUsage usage) {
+        std::lock_guard<std::mutex> lock(apiMutex);
+        if (!transientBuffer.IsValid()) {
+            spdlog::error("AllocateTransient: no transient buffer (TransientBufferSize is 0)");
+            return {};
+        }
+
+        // WebGPU's minUniformBufferOffsetAlignment / minStorageBufferOffsetAlignment default to 256
+        const bool bBound = has(usage, BufferUsage::UniformBuffer) || has(usage, BufferUsage::StorageBuffer);
+        const uint64_t alignment = bBound ? 256 : 4;
+        const uint64_t offset = (transientHead + alignment - 1) / alignment * alignment;
+        if (offset + size > transientShadow.size()) {
+            spdlog::error("AllocateTransient: {} bytes requested, frame's {} byte transient budget is used up",
+                          size, transientShadow.size());
+            return {};
+        }
+        // Kept 4-aligned so the end-of-frame wgpuQueueWriteBuffer size is a multiple of 4
+        transientHead = (offset + size + 3) / 4 * 4;
+
+        return {
+            .Buffer = transientBuffer,
+            .Offset = offset,
+            .Mapped = transientShadow.data() + offset,
+        };
+    }
+
     void RHIDeviceWebGPU::UpdateBuffer(const RHIBufferHandle& handle,
                                         const void* data, size_t size, size_t offset) {
         std::lock_guard<std::mutex> lock(apiMutex);
         auto* buf = bufferPool.Get(handle);
         if (!buf || !buf->Buffer) return;
+        // Same contract as Vulkan, where Stream buffers have one copy per frame slot
+        if (buf->Lifetime == BufferLifetime::Stream && !activeEncoder) {
+            spdlog::error("UpdateBuffer: Stream buffers can only be updated between BeginFrame and "
+                          "SubmitAndPresentFrame");
+            return;
+        }
         wgpuQueueWriteBuffer(queue, buf->Buffer, offset, data, size);
     }
 
@@ -4,6 +4,7 @@
 #include <ozz_rendering/utils/resource_pool.h>
 
 #include "rhi_buffer_webgpu.h"
+#include "rhi_graphics_state_webgpu.h"
 #include "rhi_shader_webgpu.h"
 #include "rhi_texture_webgpu.h"
 #include "utils/pipeline_cache.h"
@@ -13,6 +14,9 @@
 #include <webgpu/webgpu.h>
 
 #include <array>
+#include <atomic>
+#include <functional>
+#include <memory>
 #include <mutex>
 #include <set>
 #include <vector>
@@ -23,6 +27,7 @@ namespace OZZ::rendering::webgpu {
     struct DescriptorSetData {
         WGPUBindGroup bindGroup {nullptr};
         RHIDescriptorSetLayoutHandle layoutHandle {};
+        bool bTransient {false}; // from AllocateTransientDescriptorSet
     };
 
     // Internal storage for a bind-group layout. Retains the source descriptor and a
@@ -37,7 +42,7 @@ namespace OZZ::rendering::webgpu {
 
     class RHIDeviceWebGPU : public RHIDevice {
     public:
-        explicit RHIDeviceWebGPU(const PlatformContext& context);
+        explicit RHIDeviceWebGPU(const RHIInitParams& params);
         ~RHIDeviceWebGPU() override;
 
         // Frame
@@ -45,6 +50,30 @@ namespace OZZ::rendering::webgpu {
         void SubmitAndPresentFrame(RHIFrameContext&& frameContext) override;
         std::pair<uint32_t, uint32_t> GetSwapchainExtent() const override;
 
+        // GPU progress — emulated with wgpuQueueOnSubmittedWorkDone, one value per submit
+        uint64_t GetSubmittedGpuValue() const override;
+        uint64_t GetCompletedGpuValue() const override;
+        bool WaitForGpuValue(uint64_t value, uint64_t timeoutNs) override;
+
+        // Graphics state objects
+        RHIGraphicsStateHandle CreateGraphicsState(const GraphicsStateDescriptor& graphicsStateDescriptor) override;
+        void FreeGraphicsState(const RHIGraphicsStateHandle& graphicsStateHandle) override;
+
+        // Parallel recording — unsupported; Fork returns no contexts, Join is a no-op
+        std::vector<RHIFrameContext> ForkRecordingContexts(const RHIFrameContext& frameContext,
+                                                           uint32_t count) override;
+        void JoinRecordingContexts(const RHIFrameContext& frameContext,
+                                   std::vector<RHIFrameContext>&& recordingContexts) override;
+
+        // Async compute — unsupported (one queue); Begin returns a null context, sync points are null
+        RHIFrameContext BeginAsyncCompute(const RHIFrameContext& frameContext) override;
+        GpuSyncPoint SubmitAsyncCompute(RHIFrameContext&& computeContext) override;
+        GpuSyncPoint FlushGraphics(const RHIFrameContext& frameContext) override;
+        void AddQueueDependency(const RHIFrameContext& context,
+                                const GpuSyncPoint& syncPoint,
+                                PipelineStage waitStage) override;
+        uint32_t GetQueueFamily(QueueType queue) const override;
+
         // Render Pass
         void BeginRenderPass(const RHIFrameContext& frameContext,
                              const RenderPassDescriptor& renderPassDescriptor) override;
@@ -55,16 +84,34 @@ namespace OZZ::rendering::webgpu {
                                     const TextureBarrierDescriptor& textureBarrierDescriptor) override;
         void BufferMemoryBarrier(const RHIFrameContext& frameContext,
                                  const BufferBarrierDescriptor& bufferBarrierDescriptor) override;
+        void PipelineBarriers(const RHIFrameContext& frameContext,
+                              std::span<const TextureBarrierDescriptor> textureBarriers,
+                              std::span<const BufferBarrierDescriptor> bufferBarriers) override;
+        void TransitionTexture(const RHIFrameContext& frameContext,
+                               const RHITextureHandle& textureHandle,
+                               TextureState newState,
+                               const TextureSubresourceRange& subresourceRange) override;
 
         // State
         void SetViewport(const RHIFrameContext& frameContext, const Viewport& viewport) override;
         void SetScissor(const RHIFrameContext& frameContext, const Scissor& scissor) override;
         void SetGraphicsState(const RHIFrameContext& frameContext,
                               const GraphicsStateDescriptor& graphicsStateDescriptor) override;
+        void SetGraphicsState(const RHIFrameContext& frameContext,
+                              const RHIGraphicsStateHandle& graphicsStateHandle) override;
+        uint64_t GetElidedStateCommandCount() const override;
 
         // Binding
         void BindShader(const RHIFrameContext& frameContext, const RHIShaderHandle& shaderHandle) override;
         void BindBuffer(const RHIFrameContext& frameContext, const RHIBufferHandle& bufferHandle) override;
+        void BindVertexBuffers(const RHIFrameContext& frameContext,
+                               uint32_t firstBinding,
+                               std::span<const RHIBufferHandle> bufferHandles,
+                               std::span<const uint64_t> offsets) override;
+        void BindIndexBuffer(const RHIFrameContext& frameContext,
+                             const RHIBufferHandle& bufferHandle,
+                             uint64_t offset,
+                             IndexType indexType) override;
         void SetPushConstants(const RHIFrameContext& frameContext,
                               RHIPipelineLayoutHandle pipelineLayoutHandle,
                               ShaderStageFlags stageFlags,
@@ -74,7 +121,8 @@ namespace OZZ::rendering::webgpu {
         void BindDescriptorSet(const RHIFrameContext& frameContext,
                                RHIPipelineLayoutHandle pipelineLayoutHandle,
                                uint32_t setIndex,
-                               RHIDescriptorSetHandle descriptorSetHandle) override;
+                               RHIDescriptorSetHandle descriptorSetHandle,
+                               std::span<const uint32_t> dynamicOffsets) override;
 
         // Draw
         void Draw(const RHIFrameContext& frameContext,
@@ -88,21 +136,64 @@ namespace OZZ::rendering::webgpu {
                          uint32_t firstIndex,
                          int32_t vertexOffset,
                          uint32_t firstInstance) override;
+        void DrawIndirect(const RHIFrameContext& frameContext,
+                          const RHIBufferHandle& argumentBuffer,
+                          uint64_t offset,
+                          uint32_t drawCount,
+                          uint32_t stride) override;
+        void DrawIndexedIndirect(const RHIFrameContext& frameContext,
+                                 const RHIBufferHandle& argumentBuffer,
+                                 uint64_t offset,
+                                 uint32_t drawCount,
+                                 uint32_t stride) override;
+        void DrawIndirectCount(const RHIFrameContext& frameContext,
+                               const RHIBufferHandle& argumentBuffer,
+                               uint64_t offset,
+                               const RHIBufferHandle& countBuffer,
+                               uint64_t countOffset,
+                               uint32_t maxDrawCount,
+                               uint32_t stride) override;
+        void DrawIndexedIndirectCount(const RHIFrameContext& frameContext,
+                                      const RHIBufferHandle& argumentBuffer,
+                                      uint64_t offset,
+                                      const RHIBufferHandle& countBuffer,
+                                      uint64_t countOffset,
+                                      uint32_t maxDrawCount,
+                                      uint32_t stride) override;
+
+        // Compute — one compute pass per dispatch on the frame's command encoder
+        void Dispatch(const RHIFrameContext& frameContext,
+                      uint32_t groupCountX,
+                      uint32_t groupCountY,
+                      uint32_t groupCountZ) override;
+        void DispatchIndirect(const RHIFrameContext& frameContext,
+                              const RHIBufferHandle& bufferHandle,
+                              uint64_t offset) override;
 
         // Descriptor Sets
         RHIDescriptorSetHandle CreateDescriptorSet(RHIDescriptorSetLayoutHandle layoutHandle) override;
         void UpdateDescriptorSet(RHIDescriptorSetHandle handle,
                                  std::span<const RHIDescriptorWrite> writes) override;
         void FreeDescriptorSet(RHIDescriptorSetHandle handle) override;
+        RHIDescriptorSetHandle AllocateTransientDescriptorSet(const RHIFrameContext& frameContext,
+                                                              RHIDescriptorSetLayoutHandle layoutHandle) override;
 
         // Textures
         RHITextureHandle CreateTexture(TextureDescriptor&& descriptor) override;
         void UpdateTexture(const RHITextureHandle& handle, const void* data, size_t size) override;
         void FreeTexture(RHITextureHandle handle) override;
+        uint32_t GetBindlessIndex(const RHITextureHandle& handle) override;
+        uint32_t GetBindlessIndex(const RHIBufferHandle& handle) override;
+        UploadTicket UpdateTextureAsync(const RHITextureHandle& handle, const void* data, size_t size) override;
+        UploadTicket SubmitUploads() override;
+        bool IsUploadComplete(const UploadTicket& ticket) override;
+        bool WaitForUpload(const UploadTicket& ticket, uint64_t timeoutNs) override;
 
         // Shaders
         RHIShaderHandle CreateShader(ShaderFileParams&& fileParams) override;
         RHIShaderHandle CreateShader(ShaderSourceParams&& sourceParams) override;
+        RHIShaderHandle CreateComputeShader(ComputeShaderFileParams&& fileParams) override;
+        RHIShaderHandle CreateComputeShader(ComputeShaderSourceParams&& sourceParams) override;
         void FreeShader(const RHIShaderHandle& shaderHandle) override;
         RHIPipelineLayoutDescriptor GetShaderPipelineLayout(const RHIShaderHandle& shaderHandle) override;
         RHIPipelineLayoutHandle GetShaderPipelineLayoutHandle(const RHIShaderHandle& shaderHandle) override;
@@ -111,10 +202,13 @@ namespace OZZ::rendering::webgpu {
         std::pair<RHIPipelineLayoutHandle, std::set<RHIDescriptorSetLayoutHandle>>
         CreatePipelineLayout(const RHIPipelineLayoutDescriptor& pipelineLayoutDescriptor) override;
         RHIDescriptorSetLayoutHandle
-        CreateDescriptorSetLayout(const RHIDescriptorSetLayoutDescriptor& descriptorSetLayoutDescriptor) override;
+        CreateDescriptorSetLayout(const RHIDescriptorSetLayoutDescriptor& descriptorSetLayoutDescriptor,
+                                  const RHIPipelineLayoutHandle& pipelineLayoutHandle) override;
 
         // Buffers
         RHIBufferHandle CreateBuffer(BufferDescriptor&& bufferDescriptor) override;
+        TransientAllocation
+        AllocateTransient(const RHIFrameContext& frameContext, uint64_t size, BufferUsage usage) override;
         void UpdateBuffer(const RHIBufferHandle& handle, const void* data, size_t size, size_t offset) override;
         void FreeBuffer(const RHIBufferHandle& handle) override;
 
@@ -123,6 +217,11 @@ namespace OZZ::rendering::webgpu {
         void configureSurface();
         void createDepthTexture();
         void registerShaderLayouts(RHIShaderHandle handle, RHIShaderWebGPU& shader);
+        // Submits to the queue and registers a work-done callback that publishes the
+        // returned value to completedGpuValue. Caller holds apiMutex.
+        uint64_t submitImpl(WGPUCommandBuffer commands);
+        // Caller holds apiMutex.
+        void updateTextureImpl(const RHITextureHandle& handle, const void* data, size_t size);
 
         // Unlocked implementations. Public methods take apiMutex (a plain std::mutex) and
         // delegate here; internal callers that already hold the lock (or run during
@@ -157,6 +256,25 @@ namespace OZZ::rendering::webgpu {
         // push-constant bind group) to the active render pass encoder. Returns false
         // if the draw must be skipped (no active pass, no shader, pipeline build failed).
         bool flushPendingDrawState();
+        // Sets the pending index buffer on the active render pass; indexed draws only.
+        void applyPendingIndexBuffer();
+        // WebGPU has no multi-draw or count-buffer variants, so every indirect draw is emitted
+        // as drawCount single draws, one stride apart. Caller holds apiMutex.
+        void drawIndirectImpl(bool bIndexed,
+                              const RHIBufferHandle& argumentBuffer,
+                              uint64_t offset,
+                              uint32_t drawCount,
+                              uint32_t stride);
+        // Binds the pending descriptor sets and, when the shader declares push constants, the
+        // gap slots plus the push-constant group. Shared by render and compute passes, which
+        // differ only in the encoder's SetBindGroup entry point.
+        void applyPendingBindGroups(
+            const RHIShaderWebGPU& shader,
+            const std::function<void(uint32_t, WGPUBindGroup, size_t, const uint32_t*)>& setBindGroup);
+        WGPUComputePipeline buildComputePipeline(const ComputePipelineKey& key, const RHIShaderWebGPU& shader);
+        // Opens a compute pass with the pending compute shader and bind groups applied.
+        // Returns null (nothing opened) if the dispatch must be skipped.
+        WGPUComputePassEncoder beginComputePass();
 
     private:
         // Dawn device calls are not thread-safe on the same device/queue, so this backend
@@ -185,7 +303,19 @@ namespace OZZ::rendering::webgpu {
         uint32_t          swapchainWidth  {0};
         uint32_t          swapchainHeight {0};
 
-        static constexpr uint32_t MaxFramesInFlight {2};
+        // Device timeline emulation. submittedGpuValue is bumped per wgpuQueueSubmit under
+        // apiMutex; completedGpuValue is written from the work-done callback, which may fire
+        // after this device is gone (Dawn flushes callbacks on device loss), so the callback
+        // holds its own reference to the counter.
+        std::atomic<uint64_t> submittedGpuValue {0};
+        std::shared_ptr<std::atomic<uint64_t>> completedGpuValue {std::make_shared<std::atomic<uint64_t>>(0)};
+        // wgpuQueueWriteTexture copies the data on the spot and is ordered before the next
+        // submit, so an upload ticket is just the submission value that will carry it. Set
+        // by UpdateTextureAsync, cleared by every submit. Guarded by apiMutex.
+        bool bUploadsPending {false};
+
+        // Resolved from RHIInitParams::FramesInFlight at construction; fixed afterwards.
+        uint32_t framesInFlight    {2};
         uint32_t currentFrameIndex {0};
 
         // Active frame state (reset each frame)
@@ -205,17 +335,40 @@ namespace OZZ::rendering::webgpu {
         // Dawn validation error that invalidates the whole command buffer.
         uint32_t activePassWidth  {0};
         uint32_t activePassHeight {0};
+        // Pipeline last set on activeRenderPassEncoder; draws that resolve to the same pipeline
+        // skip wgpuRenderPassEncoderSetPipeline. Cleared when a pass begins.
+        WGPURenderPipeline activePipeline {nullptr};
+        std::atomic<uint64_t> elidedPipelineBinds {0};
 
         // Pending per-draw state (updated by Set* / Bind* before Draw)
+        // Set either from a descriptor (pendingState / pendingStateHash) or from a state
+        // object (pendingStateHandle, valid), which avoids copying the descriptor per call.
         GraphicsStateDescriptor pendingState {};
+        uint64_t                pendingStateHash {0};
+        RHIGraphicsStateHandle  pendingStateHandle {};
+        // Pipeline the last draw with a state object resolved to. A draw with the same shader,
+        // state object and attachment formats reuses it without building a PipelineKey.
+        struct StatePipeline {
+            RHIShaderHandle        Shader {};
+            RHIGraphicsStateHandle State {};
+            WGPUTextureFormat      ColorFormat {WGPUTextureFormat_Undefined};
+            WGPUTextureFormat      DepthFormat {WGPUTextureFormat_Undefined};
+            WGPURenderPipeline     Pipeline {nullptr};
+        };
+        StatePipeline lastStatePipeline {};
         RHIShaderHandle         pendingShaderHandle {};
-        RHIBufferHandle         pendingVertexBuffer {};
-        RHIBufferHandle         pendingIndexBuffer {};
-        bool                    hasPendingIndexBuffer {false};
+        struct PendingBufferBinding {
+            RHIBufferHandle Buffer {};
+            uint64_t        Offset {0};
+        };
+        std::array<PendingBufferBinding, MaxVertexBindings> pendingVertexBuffers {};
+        PendingBufferBinding    pendingIndexBuffer {};
+        WGPUIndexFormat         pendingIndexFormat {WGPUIndexFormat_Uint32};
         // True once SetGraphicsState has been called in the current render pass;
         // reset in BeginRenderPass. Guards against draws inheriting stale state.
         bool                    stateSetThisPass {false};
         std::array<RHIDescriptorSetHandle, MaxBoundDescriptorSets> pendingDescriptorSets {};
+        std::array<std::vector<uint32_t>, MaxBoundDescriptorSets> pendingDynamicOffsets {};
 
         // Push constants emulated via a dynamic-offset uniform buffer at
         // set=PushConstantSet, binding=PushConstantBinding (see utils/push_constants.h).
@@ -229,12 +382,27 @@ namespace OZZ::rendering::webgpu {
         WGPUBuffer          pushConstantBuffer {nullptr};
         WGPUBindGroupLayout pushConstantBGL    {nullptr};
         WGPUBindGroup       pushConstantBG     {nullptr};
+        // Same slots, visible to the compute stage only; used by compute pipeline layouts
+        WGPUBindGroupLayout computePushConstantBGL {nullptr};
+        WGPUBindGroup       computePushConstantBG  {nullptr};
         // Empty BGL/BG used to satisfy gap slots in pipeline layouts with push constants
         WGPUBindGroupLayout emptyBGL           {nullptr};
         WGPUBindGroup       emptyBG            {nullptr};
         uint32_t            pushConstantCursor       {0}; // slot index within current frame's region; reset each BeginFrame
         uint32_t            pendingPushConstantOffset {0}; // byte offset of the most recently written slot
 
+        // Transient allocations are written into a CPU shadow and copied to transientBuffer with
+        // a single wgpuQueueWriteBuffer just before the frame is submitted. That write is ordered
+        // after every earlier submit, so one region is enough: the previous frame has already
+        // read its data by the time the copy lands.
+        RHIBufferHandle      transientBuffer {};
+        std::vector<uint8_t> transientShadow {};
+        uint64_t             transientHead   {0}; // reset each BeginFrame
+
+        // Descriptor sets AllocateTransientDescriptorSet handed out this frame, freed together in
+        // the next BeginFrame. Dawn keeps their bind groups alive until the frame's commands retire.
+        std::vector<RHIDescriptorSetHandle> transientDescriptorSets {};
+
         // Resource pools
         ResourcePool<TextureTag,             RHITextureWebGPU>    texturePool;
         ResourcePool<CommandBufferTag,       uint32_t>            commandBufferPool;
@@ -243,11 +411,13 @@ namespace OZZ::rendering::webgpu {
         ResourcePool<PipelineLayoutTag,      WGPUPipelineLayout>  pipelineLayoutPool;
         ResourcePool<DescriptorSetLayoutTag, BindGroupLayoutData> bindGroupLayoutPool;
         ResourcePool<DescriptorSetTag,       DescriptorSetData>   descriptorSetPool;
+        ResourcePool<GraphicsStateTag,       RHIGraphicsStateWebGPU> graphicsStatePool;
 
         // Pre-allocated command buffer handles indexed by frame index
-        std::array<RHICommandBufferHandle, MaxFramesInFlight> frameCommandBuffers {};
+        std::vector<RHICommandBufferHandle> frameCommandBuffers {};
 
         PipelineCache pipelineCache;
+        ComputePipelineCache computePipelineCache;
     };
 
 } // namespace OZZ::rendering::webgpu
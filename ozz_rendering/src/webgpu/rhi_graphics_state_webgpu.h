@@ -0,0 +1,14 @@
+#pragma once
+
+#include <ozz_rendering/rhi_pipeline_state.h>
+
+namespace OZZ::rendering::webgpu {
+
+    // Graphics state is baked into render pipelines, so a state object only needs the
+    // descriptor for pipeline creation and its hash for the pipeline cache lookup.
+    struct RHIGraphicsStateWebGPU {
+        GraphicsStateDescriptor Descriptor {};
+        uint64_t Hash {0};
+    };
+
+} // namespace OZZ::rendering::webgpu
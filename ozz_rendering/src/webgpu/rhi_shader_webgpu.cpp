@@ -38,7 +38,8 @@ namespace OZZ::rendering::webgpu {
         return wgpuDeviceCreateShaderModule(device, &desc);
     }
 
-    RHIPipelineLayoutDescriptor RHIShaderWebGPU::reflectLayout(slang::IComponentType* linked) {
+    RHIPipelineLayoutDescriptor RHIShaderWebGPU::reflectLayout(slang::IComponentType* linked,
+                                                               ShaderStageFlags stages) {
         RHIPipelineLayoutDescriptor result {};
 
         slang::ProgramLayout* layout = linked->getLayout(0);
@@ -58,7 +59,9 @@ namespace OZZ::rendering::webgpu {
             if (setIndex == PushConstantSet) {
                 if (result.PushConstantCount == 0) {
                     result.PushConstants[result.PushConstantCount++] = {
-                        ShaderStageFlags::Vertex | ShaderStageFlags::Fragment,
+                        stages == ShaderStageFlags::Compute
+                            ? ShaderStageFlags::Compute
+                            : ShaderStageFlags::Vertex | ShaderStageFlags::Fragment,
                         0,
                         PushConstantSlotSize,
                     };
@@ -87,7 +90,10 @@ namespace OZZ::rendering::webgpu {
                     bool isTexture = (baseShape >= SLANG_TEXTURE_1D && baseShape <= SLANG_TEXTURE_BUFFER)
                                   || baseShape == SLANG_TEXTURE_SUBPASS;
                     if (isTexture) {
-                        descType = DescriptorType::SampledImage;
+                        // RWTexture* (write or read-write access) is a storage texture.
+                        descType = (access == SLANG_RESOURCE_ACCESS_READ)
+                                       ? DescriptorType::SampledImage
+                                       : DescriptorType::StorageImage;
                     } else {
                         // WebGPU rejects read-write storage buffers visible to the vertex
                         // stage; read-only ones are legal. Map read-only structured buffers
@@ -113,7 +119,7 @@ namespace OZZ::rendering::webgpu {
                     bindIndex,
                     descType,
                     1,
-                    ShaderStageFlags::All,
+                    stages,
                 };
             }
         }
@@ -137,6 +143,8 @@ namespace OZZ::rendering::webgpu {
             ss << f.rdbuf();
             src.Slang   = ss.str();
             src.Defines = std::move(params.Defines);
+            src.DynamicBindings = std::move(params.DynamicBindings);
+            src.BindlessSet = params.BindlessSet;
             compile(device, slangSession, std::move(src));
             return;
         }
@@ -144,6 +152,8 @@ namespace OZZ::rendering::webgpu {
         if (!params.Fragment.empty()) src.Fragment = readFile(params.Fragment);
         if (!params.Geometry.empty()) src.Geometry = readFile(params.Geometry);
         src.Defines = std::move(params.Defines);
+        src.DynamicBindings = std::move(params.DynamicBindings);
+        src.BindlessSet = params.BindlessSet;
         compile(device, slangSession, std::move(src));
     }
 
@@ -153,16 +163,35 @@ namespace OZZ::rendering::webgpu {
         compile(device, slangSession, std::move(params));
     }
 
-    bool RHIShaderWebGPU::compile(WGPUDevice device,
-                                   slang::IGlobalSession* globalSession,
-                                   ShaderSourceParams&& params) {
+    RHIShaderWebGPU::RHIShaderWebGPU(WGPUDevice device,
+                                      slang::IGlobalSession* slangSession,
+                                      ComputeShaderFileParams&& params) {
         if (params.Slang.empty()) {
             spdlog::error("WebGPU backend requires Slang shader source (GLSL support was removed)");
-            return false;
+            return; // computeModule stays null -> IsValid() == false
         }
+        std::ifstream f(params.Slang, std::ios::binary);
+        if (!f) {
+            spdlog::error("WebGPU: failed to open Slang shader file: {}", params.Slang.string());
+            return;
+        }
+        std::ostringstream ss;
+        ss << f.rdbuf();
+        ComputeShaderSourceParams src;
+        src.Slang   = ss.str();
+        src.Defines = std::move(params.Defines);
+        src.DynamicBindings = std::move(params.DynamicBindings);
+        src.BindlessSet = params.BindlessSet;
+        compileCompute(device, slangSession, std::move(src));
+    }
 
-        std::string combined = params.Slang;
+    RHIShaderWebGPU::RHIShaderWebGPU(WGPUDevice device,
+                                      slang::IGlobalSession* slangSession,
+                                      ComputeShaderSourceParams&& params) {
+        compileCompute(device, slangSession, std::move(params));
+    }
 
+    void RHIShaderWebGPU::patchPushConstantBinding(std::string& source) {
         // Slang: [[vk::push_constant]] does not emit @group/@binding in WGSL output.
         // Replace with an explicit binding at the dedicated push-constant slot (set=3, binding=0)
         // so Slang generates valid @group(3) @binding(0) decorations.
@@ -170,10 +199,26 @@ namespace OZZ::rendering::webgpu {
         // keep in sync with PushConstantBinding / PushConstantSet (utils/push_constants.h)
         static const std::string kSlangPCReplace = "[vk::binding(0, 3)]";
         for (size_t pos = 0;
-             (pos = combined.find(kSlangPCSearch, pos)) != std::string::npos; ) {
-            combined.replace(pos, kSlangPCSearch.size(), kSlangPCReplace);
+             (pos = source.find(kSlangPCSearch, pos)) != std::string::npos; ) {
+            source.replace(pos, kSlangPCSearch.size(), kSlangPCReplace);
             pos += kSlangPCReplace.size();
         }
+    }
+
+    bool RHIShaderWebGPU::compile(WGPUDevice device,
+                                   slang::IGlobalSession* globalSession,
+                                   ShaderSourceParams&& params) {
+        if (params.Slang.empty()) {
+            spdlog::error("WebGPU backend requires Slang shader source (GLSL support was removed)");
+            return false;
+        }
+        if (params.BindlessSet) {
+            spdlog::error("WebGPU: bindless sets are not supported");
+            return false;
+        }
+
+        std::string combined = params.Slang;
+        patchPushConstantBinding(combined);
 
         std::string diagnostics;
         slang::ISession* session = nullptr;
@@ -193,7 +238,9 @@ namespace OZZ::rendering::webgpu {
 
         auto& compiled = compiledOpt.value();
 
-        pipelineLayoutDescriptor = reflectLayout(compiled.Linked);
+        pipelineLayoutDescriptor =
+            reflectLayout(compiled.Linked, ShaderStageFlags::Vertex | ShaderStageFlags::Fragment);
+        ApplyDynamicBindings(pipelineLayoutDescriptor, params.DynamicBindings);
 
         auto makeModule = [&](ISlangBlob* codeBlob, const char* label) -> WGPUShaderModule {
             if (!codeBlob) {
@@ -214,13 +261,61 @@ namespace OZZ::rendering::webgpu {
         return vertexModule != nullptr;
     }
 
+    bool RHIShaderWebGPU::compileCompute(WGPUDevice device,
+                                          slang::IGlobalSession* globalSession,
+                                          ComputeShaderSourceParams&& params) {
+        if (params.Slang.empty()) {
+            spdlog::error("WebGPU backend requires Slang shader source (GLSL support was removed)");
+            return false;
+        }
+        if (params.BindlessSet) {
+            spdlog::error("WebGPU: bindless sets are not supported");
+            return false;
+        }
+        bIsCompute = true;
+
+        std::string source = params.Slang;
+        patchPushConstantBinding(source);
+
+        std::string diagnostics;
+        slang::ISession* session = nullptr;
+        auto compiledOpt = slang_compile::CompileSlangComputeProgram(
+            globalSession, SLANG_WGSL, source, params.Defines,
+            diagnostics, session, computeEntryPoint);
+        if (!diagnostics.empty()) {
+            spdlog::warn("Slang diagnostics:\n{}", diagnostics);
+        }
+        slangCompileSession = session;
+        if (!compiledOpt.has_value()) {
+            spdlog::error("Slang: WGSL compilation failed");
+            return false;
+        }
+
+        auto& compiled = compiledOpt.value();
+        pipelineLayoutDescriptor = reflectLayout(compiled.Linked, ShaderStageFlags::Compute);
+        ApplyDynamicBindings(pipelineLayoutDescriptor, params.DynamicBindings);
+
+        if (compiled.ComputeBlob) {
+            const char* wgsl = static_cast<const char*>(compiled.ComputeBlob->getBufferPointer());
+            computeModule = createWGSLModule(device, wgsl, "compute");
+            compiled.ComputeBlob->release();
+        } else {
+            spdlog::error("Slang WGSL gen failed (compute)");
+        }
+        compiled.Linked->release();
+
+        return computeModule != nullptr;
+    }
+
     void RHIShaderWebGPU::Destroy() {
         if (fragmentModule && fragmentModule != vertexModule) {
             wgpuShaderModuleRelease(fragmentModule);
         }
         if (vertexModule) wgpuShaderModuleRelease(vertexModule);
+        if (computeModule) wgpuShaderModuleRelease(computeModule);
         vertexModule   = nullptr;
         fragmentModule = nullptr;
+        computeModule  = nullptr;
     }
 
 } // namespace OZZ::rendering::webgpu
@@ -16,16 +16,22 @@ namespace OZZ::rendering::webgpu {
     public:
         RHIShaderWebGPU(WGPUDevice device, slang::IGlobalSession* slangSession, ShaderFileParams&& params);
         RHIShaderWebGPU(WGPUDevice device, slang::IGlobalSession* slangSession, ShaderSourceParams&& params);
+        RHIShaderWebGPU(WGPUDevice device, slang::IGlobalSession* slangSession, ComputeShaderFileParams&& params);
+        RHIShaderWebGPU(WGPUDevice device, slang::IGlobalSession* slangSession, ComputeShaderSourceParams&& params);
 
         void Destroy();
 
-        [[nodiscard]] bool IsValid() const { return vertexModule != nullptr; }
+        [[nodiscard]] bool IsValid() const { return bIsCompute ? computeModule != nullptr : vertexModule != nullptr; }
 
         std::string vertexEntryPoint   {"vertexMain"};
         std::string fragmentEntryPoint {"fragmentMain"};
+        std::string computeEntryPoint  {"computeMain"};
 
         WGPUShaderModule vertexModule   {nullptr};
         WGPUShaderModule fragmentModule {nullptr};
+        // Compute programs have only this module; vertex/fragment stay null.
+        WGPUShaderModule computeModule  {nullptr};
+        bool bIsCompute {false};
 
         // Slang 2026.8.1 bug: session->release() triggers heap corruption for shaders
         // with std140 matrix types targeting WGSL. Hold the compile session alive;
@@ -39,7 +45,10 @@ namespace OZZ::rendering::webgpu {
 
     private:
         bool compile(WGPUDevice device, slang::IGlobalSession* slangSession, ShaderSourceParams&& params);
-        static RHIPipelineLayoutDescriptor reflectLayout(slang::IComponentType* linked);
+        bool compileCompute(WGPUDevice device, slang::IGlobalSession* slangSession, ComputeShaderSourceParams&& params);
+        static void patchPushConstantBinding(std::string& source);
+        // `stages` is the visibility recorded on every reflected binding.
+        static RHIPipelineLayoutDescriptor reflectLayout(slang::IComponentType* linked, ShaderStageFlags stages);
 
         static WGPUShaderModule createWGSLModule(WGPUDevice device,
                                                   const char* wgsl,
@@ -11,12 +11,14 @@
 namespace OZZ::rendering::webgpu {
 
     // Identifies a unique compiled pipeline state. All fields participate in equality.
-    // Equality and hashing are byte-wise (memcmp / byte hash), which is only safe when
-    // every instance is zero-initialized before its fields are filled — always declare
-    // keys as `PipelineKey key {};` so padding bytes compare equal.
+    // Equality is byte-wise (memcmp), which is only safe when every instance is
+    // zero-initialized before its fields are filled — always declare keys as
+    // `PipelineKey key {};` so padding bytes compare equal. stateHash must be
+    // HashGraphicsState(state); hashing uses it instead of the bytes of state.
     struct PipelineKey {
         RHIShaderHandle shader {};
         GraphicsStateDescriptor state {};
+        uint64_t stateHash {0};
         WGPUTextureFormat colorFormat {WGPUTextureFormat_Undefined};
         WGPUTextureFormat depthFormat {WGPUTextureFormat_Undefined};
         WGPUPipelineLayout pipelineLayout {nullptr};
@@ -28,17 +30,45 @@ namespace OZZ::rendering::webgpu {
     static_assert(std::is_trivially_copyable_v<PipelineKey>,
                   "PipelineKey is compared/hashed via raw bytes and must stay trivially copyable");
 
+    // Compute pipelines depend only on the shader and its layout. Same zero-init rule as
+    // PipelineKey: declare as `ComputePipelineKey key {};`.
+    struct ComputePipelineKey {
+        RHIShaderHandle shader {};
+        WGPUPipelineLayout pipelineLayout {nullptr};
+
+        bool operator==(const ComputePipelineKey& o) const {
+            return std::memcmp(this, &o, sizeof(ComputePipelineKey)) == 0;
+        }
+    };
+    static_assert(std::is_trivially_copyable_v<ComputePipelineKey>,
+                  "ComputePipelineKey is compared/hashed via raw bytes and must stay trivially copyable");
+
+    inline size_t HashBytes(const void* data, size_t size, size_t h = 0xcbf29ce484222325ULL) { // FNV offset basis
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < size; i++) {
+            h ^= static_cast<size_t>(bytes[i]);
+            h *= 0x100000001b3ULL; // FNV prime
+        }
+        return h;
+    }
+
+    template <typename Key>
+    struct KeyBytesHash {
+        size_t operator()(const Key& key) const { return HashBytes(&key, sizeof(Key)); }
+    };
+
+    // The graphics state is most of the key; its hash is computed once, when the state is set
+    // or created, rather than on every lookup.
     struct PipelineKeyHash {
         size_t operator()(const PipelineKey& key) const {
-            size_t h = 0xcbf29ce484222325ULL; // FNV offset basis
-            const auto* bytes = reinterpret_cast<const uint8_t*>(&key);
-            for (size_t i = 0; i < sizeof(PipelineKey); i++) {
-                h ^= static_cast<size_t>(bytes[i]);
-                h *= 0x100000001b3ULL; // FNV prime
-            }
-            return h;
+            size_t h = HashBytes(&key.shader, sizeof(key.shader));
+            h = HashBytes(&key.stateHash, sizeof(key.stateHash), h);
+            h = HashBytes(&key.colorFormat, sizeof(key.colorFormat), h);
+            h = HashBytes(&key.depthFormat, sizeof(key.depthFormat), h);
+            return HashBytes(&key.pipelineLayout, sizeof(key.pipelineLayout), h);
         }
     };
+    using ComputePipelineKeyHash = KeyBytesHash<ComputePipelineKey>;
 
     class PipelineCache {
     public:
@@ -66,4 +96,29 @@ namespace OZZ::rendering::webgpu {
         std::unordered_map<PipelineKey, WGPURenderPipeline, PipelineKeyHash> cache;
     };
 
+    class ComputePipelineCache {
+    public:
+        // Same contract as PipelineCache::GetOrCreate.
+        template <typename Factory>
+        WGPUComputePipeline GetOrCreate(const ComputePipelineKey& key, Factory&& factory) {
+            auto it = cache.find(key);
+            if (it != cache.end()) return it->second;
+            WGPUComputePipeline pipeline = factory(key);
+            cache.emplace(key, pipeline);
+            return pipeline;
+        }
+
+        void Clear() {
+            for (auto& [key, pipeline] : cache) {
+                if (pipeline) wgpuComputePipelineRelease(pipeline);
+            }
+            cache.clear();
+        }
+
+        ~ComputePipelineCache() { Clear(); }
+
+    private:
+        std::unordered_map<ComputePipelineKey, WGPUComputePipeline, ComputePipelineKeyHash> cache;
+    };
+
 } // namespace OZZ::rendering::webgpu
@@ -38,6 +38,9 @@ namespace OZZ::rendering::webgpu {
             flags |= WGPUTextureUsage_CopySrc;
         if (static_cast<uint8_t>(usage) & static_cast<uint8_t>(TextureUsage::TransferDst))
             flags |= WGPUTextureUsage_CopyDst;
+        if (static_cast<uint8_t>(usage) & static_cast<uint8_t>(TextureUsage::Storage))
+            flags |= WGPUTextureUsage_StorageBinding;
+        // TextureUsage::Transient is a memory hint; the implementation places attachments itself
         return flags;
     }
 
@@ -78,12 +81,18 @@ namespace OZZ::rendering::webgpu {
         return flags;
     }
 
+    inline WGPUIndexFormat ToWebGPU(IndexType type) {
+        return type == IndexType::UInt16 ? WGPUIndexFormat_Uint16 : WGPUIndexFormat_Uint32;
+    }
+
     inline WGPUShaderStage ToWebGPU(ShaderStageFlags stages) {
         WGPUShaderStage flags = WGPUShaderStage_None;
         if (static_cast<uint32_t>(stages) & static_cast<uint32_t>(ShaderStageFlags::Vertex))
             flags |= WGPUShaderStage_Vertex;
         if (static_cast<uint32_t>(stages) & static_cast<uint32_t>(ShaderStageFlags::Fragment))
             flags |= WGPUShaderStage_Fragment;
+        if (static_cast<uint32_t>(stages) & static_cast<uint32_t>(ShaderStageFlags::Compute))
+            flags |= WGPUShaderStage_Compute;
         return flags;
     }
 